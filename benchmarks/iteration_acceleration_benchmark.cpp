@@ -0,0 +1,111 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compares stretch error against wall time for plain and accelerated constraint iterations
+// on a hanging cloth using the material of a config file.
+// Usage: iteration_acceleration_benchmark [config] [frames]
+
+#include "engine/Cloth.hpp"
+#include "engine/ClothMesh.hpp"
+#include "engine/World.hpp"
+#include "io/ConfigLoader.hpp"
+#include "physics/GravityForce.hpp"
+#include "physics/Solver.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+using namespace ClothSDK;
+
+namespace {
+
+struct Scheme {
+    const char* name;
+    ConstraintSolveMode mode;
+    IterationAcceleration acceleration;
+};
+
+struct Result {
+    double msPerFrame;
+    double meanStretch;
+    double maxStretch;
+};
+
+Result run(const std::string& config, const Scheme& scheme, int iterations, int frames) {
+    World world;
+    Solver solver;
+    auto material = std::make_shared<ClothMaterial>();
+    if (!ConfigLoader::load(config, solver, world, *material))
+        std::fprintf(stderr, "could not load %s, using the default material\n", config.c_str());
+
+    solver.setIterations(iterations);
+    solver.setConstraintSolveMode(scheme.mode);
+    solver.setIterationAcceleration(scheme.acceleration);
+
+    // 2 m square sheet hanging from its top corners.
+    const int side = 40;
+    auto cloth = std::make_shared<Cloth>("cloth", material);
+    ClothMesh mesh;
+    mesh.initGrid(side, side, 0.05, *cloth, solver);
+    for (int col : { 0, side - 1 }) {
+        const int id = cloth->getParticleID(0, col);
+        solver.addPin(id, solver.getParticleStore().getPosition(id));
+    }
+    world.addCloth(cloth);
+    world.addForce(std::make_shared<GravityForce>(world.getGravity()));
+
+    // Relative stretch of the distance constraints, averaged over the frames.
+    double sum = 0.0;
+    double worst = 0.0;
+    double seconds = 0.0;
+    for (int frame = 0; frame < frames; ++frame) {
+        auto start = std::chrono::steady_clock::now();
+        solver.update(world, 1.0 / 60.0);
+        auto stop = std::chrono::steady_clock::now();
+        seconds += std::chrono::duration<double>(stop - start).count();
+
+        const ParticleStore& particles = solver.getParticleStore();
+        for (const DistanceConstraint& c : solver.getDistanceConstraints()) {
+            const double length = (particles.getPosition(c.idA) - particles.getPosition(c.idB)).norm();
+            const double stretch = std::abs(length - c.restLength) / c.restLength;
+            sum += stretch;
+            worst = std::max(worst, stretch);
+        }
+    }
+
+    Result result;
+    result.msPerFrame = 1000.0 * seconds / frames;
+    result.meanStretch = 100.0 * sum / (static_cast<double>(frames) * solver.getDistanceConstraints().size());
+    result.maxStretch = 100.0 * worst;
+    return result;
+}
+
+}
+
+int main(int argc, char** argv) {
+    const std::string config = argc > 1 ? argv[1] : "data/configs/denim.json";
+    const int frames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 120;
+
+    const Scheme schemes[] = {
+        { "gauss-seidel", ConstraintSolveMode::Sequential, IterationAcceleration::None },
+        { "gauss-seidel+chebyshev", ConstraintSolveMode::Sequential, IterationAcceleration::Chebyshev },
+        { "colored", ConstraintSolveMode::Colored, IterationAcceleration::None },
+        { "colored+sor", ConstraintSolveMode::Colored, IterationAcceleration::OverRelaxation },
+        { "colored+chebyshev", ConstraintSolveMode::Colored, IterationAcceleration::Chebyshev },
+    };
+    const int iterationCounts[] = { 2, 4, 8 };
+
+    std::printf("%-24s %10s %12s %12s %12s\n", "scheme", "iterations", "ms/frame", "mean str %", "max str %");
+    for (const Scheme& scheme : schemes) {
+        for (int iterations : iterationCounts) {
+            Result result = run(config, scheme, iterations, frames);
+            std::printf("%-24s %10d %12.3f %12.4f %12.4f\n", scheme.name, iterations,
+                        result.msPerFrame, result.meanStretch, result.maxStretch);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures SpatialHash::build from 10k to 1M particles for increasing thread counts.
+// Usage: spatial_hash_benchmark [repetitions]
+
+#include "physics/ParticleStore.hpp"
+#include "physics/SpatialHash.hpp"
+#include <omp.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+void fillCloth(ParticleStore& particles, int count) {
+    // A crumpled sheet: particles on a noisy grid, roughly as dense as a draped cloth.
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> noise(-0.004, 0.004);
+    const int side = static_cast<int>(std::sqrt(static_cast<double>(count))) + 1;
+    const double spacing = 0.01;
+
+    particles.clear();
+    particles.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        double x = (i % side) * spacing;
+        double z = (i / side) * spacing;
+        double y = 0.05 * std::sin(x * 7.0) * std::cos(z * 5.0);
+        particles.add(Particle(Vec3(x + noise(rng), y + noise(rng), z + noise(rng))));
+    }
+}
+
+double timeBuild(SpatialHash& hash, const ParticleStore& particles, int repetitions) {
+    hash.build(particles);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; ++r)
+        hash.build(particles);
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(stop - start).count() / repetitions;
+}
+
+}
+
+int main(int argc, char** argv) {
+    const int repetitions = argc > 1 ? std::max(1, std::atoi(argv[1])) : 20;
+    const int maxThreads = omp_get_max_threads();
+    const int counts[] = { 10000, 100000, 1000000 };
+
+    std::vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2)
+        threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+
+    std::printf("%10s", "particles");
+    for (int threads : threadCounts)
+        std::printf(" %8dT ms", threads);
+    std::printf("   speedup\n");
+
+    ParticleStore particles;
+    for (int count : counts) {
+        fillCloth(particles, count);
+        SpatialHash hash(10007, 0.02);
+
+        std::printf("%10d", count);
+        double serial = 0.0;
+        double last = 0.0;
+        for (int threads : threadCounts) {
+            omp_set_num_threads(threads);
+            last = timeBuild(hash, particles, repetitions);
+            if (threads == 1) serial = last;
+            std::printf(" %11.3f", last);
+        }
+        std::printf("   %6.2fx\n", serial / last);
+    }
+
+    omp_set_num_threads(maxThreads);
+    return 0;
+}
@@ -59,6 +59,16 @@ public:
     void addTriangle(const Triangle& tri);
     void addVisualEdge(unsigned int idA, unsigned int idB);
 
+    /**
+     * @brief Relabels every particle index held by the cloth after the solver reorders its particles.
+     *
+     * The local order of particles, triangles and edges is kept, so grid lookups and
+     * exports still see the same mesh.
+     *
+     * @param newIndex New index of every current particle index.
+     */
+    void remapParticles(const std::vector<int>& newIndex);
+
     void clear();
 
 private:
@@ -32,7 +32,7 @@ public:
 
     void initGrid(int rows, int cols, double spacing, Cloth& outCloth, Solver& solver);
 
-    void buildFromMesh(const std::vector<Eigen::Vector3d>& positions, 
+    void buildFromMesh(const std::vector<Vec3>& positions, 
                         const std::vector<int>& indices, 
                         Cloth& outCloth, 
                         Solver& solver);
@@ -20,6 +20,7 @@
 #include <vector>
 #include <string>
 #include <Eigen/Dense>
+#include "math/Types.hpp"
 
 namespace ClothSDK {
 
@@ -36,18 +37,18 @@ public:
     void addForce(std::shared_ptr<Force> force);
     void clear();
 
-    void addPlaneCollider(const Eigen::Vector3d& origin, const Eigen::Vector3d& normal, double friction);
-    void addSphereCollider(const Eigen::Vector3d& center, double radius, double friction);
+    void addPlaneCollider(const Vec3& origin, const Vec3& normal, Scalar friction);
+    void addSphereCollider(const Vec3& center, Scalar radius, Scalar friction);
 
-    inline void setGravity(const Eigen::Vector3d& gravity) { m_gravity = gravity; }
-    inline void setWind(const Eigen::Vector3d& wind) { m_wind = wind; }
-    inline void setAirDensity(double density) { m_airDensity = density; }
-    inline void setThickness(double thickness) { m_thickness = thickness; }
+    inline void setGravity(const Vec3& gravity) { m_gravity = gravity; }
+    inline void setWind(const Vec3& wind) { m_wind = wind; }
+    inline void setAirDensity(Scalar density) { m_airDensity = density; }
+    inline void setThickness(Scalar thickness) { m_thickness = thickness; }
     
-    inline const Eigen::Vector3d& getGravity() const { return m_gravity; }
-    inline const Eigen::Vector3d& getWind() const { return m_wind; }
-    inline double getAirDensity() const { return m_airDensity; }
-    inline double getThickness() const { return m_thickness; }
+    inline const Vec3& getGravity() const { return m_gravity; }
+    inline const Vec3& getWind() const { return m_wind; }
+    inline Scalar getAirDensity() const { return m_airDensity; }
+    inline Scalar getThickness() const { return m_thickness; }
 
     inline const std::vector<std::shared_ptr<Cloth>>& getCloths() const { return m_cloths; }
     inline const std::vector<std::shared_ptr<Collider>>& getColliders() const { return m_colliders; }
@@ -58,10 +59,10 @@ private:
     std::vector<std::shared_ptr<Collider>> m_colliders;
     std::vector<std::shared_ptr<Force>> m_forces;
 
-    Eigen::Vector3d m_gravity;
-    Eigen::Vector3d m_wind;
-    double m_airDensity;
-    double m_thickness;
+    Vec3 m_gravity;
+    Vec3 m_wind;
+    Scalar m_airDensity;
+    Scalar m_thickness;
 };
 
 } 
\ No newline at end of file
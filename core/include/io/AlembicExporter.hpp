@@ -20,6 +20,7 @@
 #include <vector>
 #include <memory>
 #include <Eigen/Dense>
+#include "math/Types.hpp"
 
 namespace ClothSDK {
 
@@ -41,7 +42,7 @@ public:
      * @return true if the file was successfully created.
      */
     bool open(const std::string& path, 
-              const std::vector<Eigen::Vector3d>& positions, 
+              const std::vector<Vec3>& positions, 
               const std::vector<int>& indices);
 
     /**
@@ -49,7 +50,7 @@ public:
      * @param positions Current vertex positions from the solver.
      * @param time The timestamp for this frame.
      */
-    void writeFrame(const std::vector<Eigen::Vector3d>& positions, double time);
+    void writeFrame(const std::vector<Vec3>& positions, double time);
 
     /**
      * @brief Finalizes the archive and closes the file.
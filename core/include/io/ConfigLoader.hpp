@@ -68,17 +68,17 @@ private:
     /**
      * @brief Converts a JSON object into an Eigen vector.
      * @param json JSON object containing coordinates 
-     * @return Eigen::Vector3d Resulting vector representation.
+     * @return Vec3 Resulting vector representation.
      */
-    static Eigen::Vector3d jsonToVector(const nlohmann::json& json);    
+    static Vec3 jsonToVector(const nlohmann::json& json);    
     
     /**
      * @brief Converts an Eigen vector into a JSON object.
      * 
-     * @param vector The Eigen::Vector3d to be converted.
+     * @param vector The Vec3 to be converted.
      * @return nlohmann::json A JSON object representing the vector's coordinates.
      */
-    static nlohmann::json vectorToJson(const Eigen::Vector3d& vector);      
+    static nlohmann::json vectorToJson(const Vec3& vector);      
     
 };
 
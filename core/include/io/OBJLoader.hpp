@@ -18,12 +18,13 @@
 #include <string>
 #include <vector>
 #include <Eigen/Dense>
+#include "math/Types.hpp"
 
 namespace ClothSDK {
 
 class OBJLoader {
 public:
-    static bool load(const std::string& path, std::vector<Eigen::Vector3d>& outPos, std::vector<int>& outIndices);
+    static bool load(const std::string& path, std::vector<Vec3>& outPos, std::vector<int>& outIndices);
 };
 
 }
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+namespace ClothSDK {
+
+/**
+ * @brief Floating-point type used for all simulation state.
+ *
+ * Defaults to @c double. Configuring with @c CLOTHSDK_USE_FLOAT=ON switches the solver
+ * to single precision, which halves the memory traffic of the particle and constraint
+ * arrays and doubles the lane count of the SIMD kernels.
+ */
+#ifdef CLOTHSDK_USE_FLOAT
+using Scalar = float;
+#else
+using Scalar = double;
+#endif
+
+}
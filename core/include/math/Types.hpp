@@ -17,8 +17,20 @@
 
 #pragma once
 
+#include <Eigen/Core>
+#include "math/Scalar.hpp"
+
 namespace ClothSDK {
 
+/** @brief 3D vector in simulation precision. */
+using Vec3 = Eigen::Matrix<Scalar, 3, 1>;
+
+/** @brief 3x3 matrix in simulation precision. */
+using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
+
+/** @brief 4x4 homogeneous transform in simulation precision. */
+using Mat4 = Eigen::Matrix<Scalar, 4, 4>;
+
 struct Triangle {
     int a, b, c;
     Triangle(int _a, int _b, int _c) : a(_a), b(_b), c(_c) {}
@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 #include <Eigen/Dense>
 
 #include "physics/Force.hpp"
-#include "physics/Particle.hpp"
+#include "physics/ParticleStore.hpp"
+#include "physics/WindField.hpp"
 
 namespace ClothSDK {
 
@@ -28,28 +30,60 @@ struct AeroFace {
     int a, b, c;
 };
 
+/**
+ * @class AerodynamicForce
+ * @brief Drag and lift on cloth triangles from the motion relative to the wind.
+ *
+ * Each application runs three lock-free passes: vertex velocities are derived once,
+ * every face writes its force into its own slot, and every vertex gathers the slots
+ * of its faces through a vertex-to-face table in compressed sparse row form. The
+ * table is rebuilt only when the faces or the particle count change.
+ *
+ * Without a wind field the wind is uniform, pulsed by a built-in gust. With one, each
+ * face feels the uniform wind plus the field sampled at its centroid.
+ */
 class AerodynamicForce final : public Force {
 public:
     AerodynamicForce(
         const std::vector<AeroFace>& faces,
-        const Eigen::Vector3d& wind,
-        double airDensity
+        const Vec3& wind,
+        Scalar airDensity
     );
 
-    void apply(std::vector<Particle>& particles, double dt) override;
+    void apply(ParticleStore& particles, Scalar dt) override;
+    void remapParticles(const std::vector<int>& newIndex) override;
 
-    inline void setWind(const Eigen::Vector3d& wind);
-    inline const Eigen::Vector3d& getWind() const;
+    inline void setWind(const Vec3& wind);
+    inline const Vec3& getWind() const;
 
-    inline void setAirDensity(double density);
-    inline double getAirDensity() const;
-    inline void setFaces(AeroFace face) { m_faces.push_back(face); }
+    inline void setAirDensity(Scalar density);
+    inline Scalar getAirDensity() const;
+    inline void setFaces(AeroFace face) { m_faces.push_back(face); m_vertexFacesDirty = true; }
+
+    /**
+     * @brief Adds a spatially varying wind on top of the uniform one.
+     *
+     * Replaces the built-in gust. Several forces may share one field.
+     *
+     * @param field Field to sample, or nullptr to go back to the uniform gusting wind.
+     */
+    inline void setWindField(std::shared_ptr<WindField> field) { m_windField = std::move(field); }
+    inline const std::shared_ptr<WindField>& getWindField() const { return m_windField; }
 
 private:
+    void buildVertexFaces(int particleCount);
+
     std::vector<AeroFace> m_faces;
-    Eigen::Vector3d m_wind;
-    double m_airDensity;
-    double m_time = 0.0;
+    Vec3 m_wind;
+    Scalar m_airDensity;
+    Scalar m_time = 0.0;
+    std::shared_ptr<WindField> m_windField;
+
+    std::vector<Vec3> m_velocities;     ///< Per-particle velocity of the current application.
+    std::vector<Vec3> m_faceForces;     ///< Share of each face's force for one of its vertices.
+    std::vector<int> m_vertexOffsets;   ///< Faces of particle @c i are m_vertexFaces[m_vertexOffsets[i], m_vertexOffsets[i+1]).
+    std::vector<int> m_vertexFaces;
+    bool m_vertexFacesDirty = true;
 };
 
 }
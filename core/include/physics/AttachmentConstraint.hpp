@@ -0,0 +1,43 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "physics/ParticleStore.hpp"
+#include <vector>
+
+namespace ClothSDK {
+
+/**
+ * @brief Long-range attachment: keeps a particle within a maximum distance of an anchor.
+ *
+ * Unilateral; the particle is only moved when it is farther than @c maxDistance from the
+ * anchor, and the anchor is never moved. The solver generates one per free particle from
+ * the geodesic distance to the nearest pinned particle (see Solver::setLongRangeAttachments).
+ */
+struct AttachmentConstraint {
+    int particleId;     ///< Particle kept near the anchor.
+    int anchorId;       ///< Pinned or immovable particle.
+    Scalar maxDistance; ///< Geodesic rest distance from the anchor.
+
+    AttachmentConstraint(int particleId, int anchorId, Scalar maxDistance);
+    void solve(ParticleStore& particles) const;
+
+    inline void getParticleIds(std::vector<int>& outIds) const { outIds.push_back(particleId); outIds.push_back(anchorId); }
+    inline void remapParticles(const std::vector<int>& newIndex) { particleId = newIndex[particleId]; anchorId = newIndex[anchorId]; }
+};
+
+}
@@ -16,22 +16,43 @@
 
 #pragma once
 
-#include "Constraint.hpp"
-
-#include "Particle.hpp"
+#include "ConstraintResidual.hpp"
+#include "ParticleStore.hpp"
 #include <vector>
 
 namespace ClothSDK {
 
-class BendingConstraint : public Constraint {
-public:
-    BendingConstraint(int idA, int idB, int idc, int idD, double restAngle, double compliance);
-
-    void solve(std::vector<Particle>& particles, double dt) override;
-
-private:
-    int m_idA, m_idB, m_idC, m_idD;
-    double m_restAngle;
+/**
+ * @struct BendingConstraint
+ * @brief Dihedral angle constraint between the two triangles sharing the edge (A, B).
+ *
+ * C and D are the vertices opposite to the shared edge. Stored by value in the
+ * solver's bending bucket.
+ */
+struct BendingConstraint {
+    int idA, idB, idC, idD;
+    Scalar restAngle;
+    Scalar compliance;
+    Scalar lambda;
+
+    BendingConstraint(int idA, int idB, int idC, int idD, Scalar restAngle, Scalar compliance);
+
+    /**
+     * @brief Projects the dihedral angle towards its rest value.
+     *
+     * @param residual When given, receives @f$ C @f$ before the correction; constraints
+     * of four immovable particles are left out.
+     */
+    void solve(ParticleStore& particles, Scalar dt, ConstraintResidual* residual = nullptr);
+
+    /** @return Current dihedral angle minus the rest angle, or 0 for degenerate triangles. */
+    Scalar evaluate(const ParticleStore& particles) const;
+
+    inline void resetLambda() { lambda = 0.0; }
+    inline void getParticleIds(std::vector<int>& outIds) const { outIds.insert(outIds.end(), { idA, idB, idC, idD }); }
+    inline void remapParticles(const std::vector<int>& newIndex) {
+        idA = newIndex[idA]; idB = newIndex[idB]; idC = newIndex[idC]; idD = newIndex[idD];
+    }
 };
 
 }
\ No newline at end of file
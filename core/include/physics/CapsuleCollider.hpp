@@ -20,20 +20,53 @@
 
 namespace ClothSDK {
 
+/**
+ * @class CapsuleCollider
+ * @brief Segment swept by a sphere, the usual primitive for limbs and bones.
+ *
+ * Like the sphere, a capsule can be animated with a target pose for the end of the
+ * next frame. Both endpoints are interpolated per substep and friction acts on the
+ * particle's motion relative to the surface point it touches.
+ */
 class CapsuleCollider : public Collider {
 public:
-    CapsuleCollider(double radius, const Eigen::Vector3d& start, const Eigen::Vector3d& end, double friction);
+    CapsuleCollider(Scalar radius, const Vec3& start, const Vec3& end, Scalar friction);
+
+    void resolve(ParticleStore& particles, Scalar dt, Scalar thickness) override;
+    void resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar dt, Scalar thickness) override;
+    bool getBounds(Vec3& outLower, Vec3& outUpper) const override;
+    void setFrameTime(Scalar alpha) override;
+    void endFrame() override;
 
-    void resolve(std::vector<Particle>& particles, double dt, double thickness) override;
+    /**
+     * @brief Moves the capsule immediately, without any surface velocity.
+     *
+     * @param start New first endpoint; also replaces any pending target.
+     * @param end New second endpoint.
+     */
+    void setPose(const Vec3& start, const Vec3& end);
 
-    inline double getRadius() const { return m_radius; }
-    inline const Eigen::Vector3d& getStart() const { return m_start; }
-    inline const Eigen::Vector3d& getEnd() const { return m_end; }
+    /**
+     * @brief Sets the endpoints the capsule should reach at the end of the next Solver::update().
+     *
+     * @param start First endpoint at the end of the frame.
+     * @param end Second endpoint at the end of the frame.
+     */
+    void setTargetPose(const Vec3& start, const Vec3& end);
+
+    inline Scalar getRadius() const { return m_radius; }
+    inline const Vec3& getStart() const { return m_start; }
+    inline const Vec3& getEnd() const { return m_end; }
 
 private:
-    double m_radius;
-    Eigen::Vector3d m_start;
-    Eigen::Vector3d m_end;
+    void resolveParticle(Vec3& position, Vec3& oldPosition, Scalar collisionRadius) const;
+
+    Scalar m_radius;
+    Vec3 m_start;
+    Vec3 m_end;
+    Vec3 m_frameStart, m_frameEnd;         ///< Endpoints at the start of the current frame.
+    Vec3 m_targetStart, m_targetEnd;       ///< Endpoints at the end of the current frame.
+    Vec3 m_previousStart, m_previousEnd;   ///< Endpoints at the start of the current substep.
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Collider.hpp"
+#include "physics/TriangleBVH.hpp"
+
+namespace ClothSDK {
+
+/**
+ * @class CapsuleSetCollider
+ * @brief Many capsules attached to the bones of a skeleton, resolved as one collider.
+ *
+ * Capsule endpoints are given in the local frame of a bone and placed in the world by
+ * the bone matrices passed once per frame. Endpoints and radii are stored as separate
+ * arrays, and a BVH over the capsule segments is refitted every substep so each
+ * particle only tests the capsules near it. A particle is pushed out of the single
+ * capsule it penetrates deepest, in one parallel pass over the particles.
+ *
+ * Like CapsuleCollider, the set is kinematic: setTargetBoneTransforms() is reached at
+ * the end of the next frame and friction acts on the motion relative to the surface.
+ */
+class CapsuleSetCollider : public Collider {
+public:
+    /**
+     * @param friction The friction coefficient [0.0 - 1.0] for tangential damping.
+     */
+    explicit CapsuleSetCollider(Scalar friction);
+
+    /**
+     * @brief Attaches a capsule to a bone.
+     *
+     * The capsule is placed with the current bone matrices, or at its local endpoints
+     * until the bone has a matrix.
+     *
+     * @param bone Index into the bone matrix array.
+     * @param radius Capsule radius.
+     * @param start First endpoint in the bone's frame.
+     * @param end Second endpoint in the bone's frame.
+     * @return Index of the new capsule.
+     */
+    int addCapsule(int bone, Scalar radius, const Vec3& start, const Vec3& end);
+
+    /**
+     * @brief Places every capsule immediately, without any surface velocity.
+     *
+     * Arrays shorter than getBoneCount() are rejected with a warning.
+     *
+     * @param bones World transform of each bone; also replaces any pending target.
+     */
+    void setBoneTransforms(const std::vector<Mat4>& bones);
+
+    /**
+     * @brief Sets the bone transforms reached at the end of the next Solver::update().
+     *
+     * @param bones World transform of each bone at the end of the frame.
+     */
+    void setTargetBoneTransforms(const std::vector<Mat4>& bones);
+
+    void resolve(ParticleStore& particles, Scalar dt, Scalar thickness) override;
+    void resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar dt, Scalar thickness) override;
+    bool getBounds(Vec3& outLower, Vec3& outUpper) const override;
+    void setFrameTime(Scalar alpha) override;
+    void endFrame() override;
+
+    inline int getCapsuleCount() const { return static_cast<int>(m_radii.size()); }
+    inline int getBoneCount() const { return m_boneCount; }
+    inline const std::vector<Vec3>& getStarts() const { return m_starts; }
+    inline const std::vector<Vec3>& getEnds() const { return m_ends; }
+    inline const std::vector<Scalar>& getRadii() const { return m_radii; }
+
+private:
+    void placeCapsules(const std::vector<Mat4>& bones, std::vector<Vec3>& outStarts, std::vector<Vec3>& outEnds) const;
+    void rebuildTree();
+    void resolveParticle(Vec3& position, Vec3& oldPosition, Scalar thickness, std::vector<int>& candidates) const;
+
+    std::vector<int> m_bones;           ///< Bone of each capsule.
+    std::vector<Scalar> m_radii;
+    std::vector<Vec3> m_localStarts;    ///< Endpoints in the bone frame.
+    std::vector<Vec3> m_localEnds;
+    std::vector<Vec3> m_starts;         ///< World endpoints at the current substep.
+    std::vector<Vec3> m_ends;
+    std::vector<Vec3> m_previousStarts; ///< World endpoints at the start of the current substep.
+    std::vector<Vec3> m_previousEnds;
+    std::vector<Vec3> m_frameStarts;    ///< World endpoints at the start of the current frame.
+    std::vector<Vec3> m_frameEnds;
+    std::vector<Vec3> m_targetStarts;   ///< World endpoints at the end of the current frame.
+    std::vector<Vec3> m_targetEnds;
+    std::vector<Mat4> m_boneTransforms; ///< Latest bone matrices, used to place new capsules.
+    int m_boneCount;                    ///< One more than the highest bone index in use.
+    Scalar m_maxRadius;
+
+    TriangleBVH m_tree;                 ///< Capsule i is the degenerate triangle (i, i, i).
+};
+
+}
@@ -17,10 +17,11 @@
 #pragma once
 
 #include <vector>
+#include "math/Types.hpp"
 
 namespace ClothSDK {
 
-class Particle;
+class ParticleStore;
 
 /**
  * @class Collider
@@ -44,27 +45,80 @@ public:
      * 
      * Derived classes must implement the specific geometry projection logic. 
      *
-     * @param particles Reference to the global particle buffer.
+     * @param particles Reference to the solver's particle store.
      * @param dt Current substep time delta. Required for kinematic friction calculations.
      */
-    virtual void resolve(std::vector<Particle>& particles, double dt, double thickness) = 0;
+    virtual void resolve(ParticleStore& particles, Scalar dt, Scalar thickness) = 0;
+
+    /**
+     * @brief Resolves only the listed particles.
+     *
+     * Called by the solver's broad phase with the particles inside getBounds() padded
+     * by the thickness. The default falls back to a full resolve() pass, so colliders
+     * that do not override it stay correct, just without the culling.
+     *
+     * @param particles Reference to the solver's particle store.
+     * @param candidates Particle indices to test, in increasing order.
+     * @param dt Current substep time delta.
+     * @param thickness Collision margin around the surface.
+     */
+    virtual void resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar dt, Scalar thickness);
+
+    /**
+     * @brief World-space box outside which the collider cannot touch a particle.
+     *
+     * @param outLower Receives the minimum corner.
+     * @param outUpper Receives the maximum corner.
+     * @return False for unbounded colliders such as planes; the default.
+     */
+    virtual bool getBounds(Vec3& /*outLower*/, Vec3& /*outUpper*/) const { return false; }
+
+    /**
+     * @brief Moves a kinematic collider to its pose at a fraction of the current frame.
+     *
+     * The solver calls this before every substep with the substep's end time. Animated
+     * colliders interpolate between the pose the frame started at and the target set
+     * for its end, and remember the previous pose so resolve() can measure how far the
+     * surface moved. Static colliders ignore it; the default.
+     *
+     * @param alpha 0 at the start of the frame, 1 at its end.
+     */
+    virtual void setFrameTime(Scalar /*alpha*/) {}
+
+    /**
+     * @brief Makes the reached target the starting pose of the next frame.
+     *
+     * Called once at the end of Solver::update(). Without a new target the collider
+     * then stays where it is.
+     */
+    virtual void endFrame() {}
 
     /**
      * @brief Configures the surface friction coefficient.
      * 
      * @param friction Friction value in the range [0.0, 1.0]
      */
-    void setFriction(double friction) { m_friction = friction; }
+    void setFriction(Scalar friction) { m_friction = friction; }
 
     /** @return The current surface friction coefficient. */
-    inline double getFriction() const { return m_friction; }
+    inline Scalar getFriction() const { return m_friction; }
 
 protected:
     /**
      * @brief Tangential friction coefficient used during collision response.
      * 
      */
-    double m_friction = 0.5;
+    Scalar m_friction = 0.5;
+
+    /**
+     * @brief Velocity after a contact, with friction acting on the slip against the surface.
+     *
+     * @param velocity Particle displacement over the substep, after projection.
+     * @param normal Unit contact normal.
+     * @param surfaceDisplacement Displacement of the touched surface point over the substep.
+     * @return The damped displacement; the old position becomes position minus this.
+     */
+    Vec3 frictionVelocity(const Vec3& velocity, const Vec3& normal, const Vec3& surfaceDisplacement) const;
 };
 
 }
\ No newline at end of file
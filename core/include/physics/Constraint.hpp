@@ -16,7 +16,7 @@
 
 #pragma once
 
-#include "Particle.hpp"
+#include "ParticleStore.hpp"
 #include <vector>
 
 namespace ClothSDK {
@@ -49,10 +49,31 @@ public:
      * Derivated classes must implement the specific XPBD projection logic here.
      *
      * 
-     * @param particles Reference to the global particle buffer.
+     * @param particles Reference to the solver's particle store.
      * @param dt The current substep time delta.
      */
-    virtual void solve(std::vector<Particle>& particles, double dt) = 0;
+    virtual void solve(ParticleStore& particles, Scalar dt) = 0;
+
+    /**
+     * @brief Appends the indices of the particles touched by this constraint.
+     *
+     * The solver uses this footprint to color constraints into independent batches.
+     * Constraints that report no particles are assumed to touch everything and are
+     * always projected sequentially.
+     *
+     * @param outIds Buffer the particle indices are appended to.
+     */
+    virtual void getParticleIds(std::vector<int>& /*outIds*/) const {}
+
+    /**
+     * @brief Relabels the particle indices stored by the constraint.
+     *
+     * Called when the solver reorders its particles. Constraints that keep particle
+     * indices must override it.
+     *
+     * @param newIndex New index of every current particle index.
+     */
+    virtual void remapParticles(const std::vector<int>& /*newIndex*/) {}
 
     /**
      * @brief Resets the accumulated Lagrange multiplier.
@@ -65,13 +86,13 @@ protected:
      * @brief Accumulated Lagrange multiplier for the current substep.
      * 
      */
-    double m_lambda;  
+    Scalar m_lambda;  
     
     /**
      * @brief Physical compliance of the constraint.
      * 
      */
-    double m_compliance;    
+    Scalar m_compliance;    
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace ClothSDK {
+
+/**
+ * @struct ConstraintBatches
+ * @brief Batch boundaries of a constraint array that has been sorted by color.
+ */
+struct ConstraintBatches {
+    std::vector<int> offsets;   ///< Batch @c b covers constraints [offsets[b], offsets[b+1]).
+    std::vector<int> colors;    ///< Color of each batch; ConstraintColoring::MaxColors marks the overflow batch.
+
+    inline int count() const { return static_cast<int>(colors.size()); }
+    inline void clear() { offsets.clear(); colors.clear(); }
+};
+
+/**
+ * @class ConstraintColoring
+ * @brief Partitions constraints into batches that share no particles.
+ *
+ * Two constraints that touch the same particle cannot be projected at the same time
+ * without racing on that particle's position. Coloring the constraint graph greedily
+ * yields batches (colors) whose members are fully independent, so each batch can be
+ * projected in parallel while batches are still processed in Gauss-Seidel order.
+ *
+ * The greedy pass is sequential and visits constraints in insertion order, so the
+ * result only depends on the constraint list and never on the thread count.
+ */
+class ConstraintColoring {
+public:
+    /**
+     * @brief Maximum number of independent colors.
+     *
+     * Constraints that cannot be placed in any of these colors go to a final overflow
+     * batch that must be solved sequentially.
+     */
+    static constexpr int MaxColors = 64;
+
+    /**
+     * @brief Greedily assigns a color to every constraint.
+     *
+     * The particles of constraint @c i are @c ids[offsets[i]] to @c ids[offsets[i+1]-1].
+     * A constraint with no particles is treated as touching everything and is sent to
+     * the overflow batch.
+     *
+     * @param particleCount Number of particles in the solver.
+     * @param offsets Per-constraint offsets into @p ids (size = constraints + 1).
+     * @param ids Flattened particle indices of every constraint.
+     * @param outColors Receives the color of each constraint, @c MaxColors for overflow.
+     * @return Number of batches needed, including the overflow batch if used.
+     */
+    static int colorize(int particleCount,
+                        const std::vector<int>& offsets,
+                        const std::vector<int>& ids,
+                        std::vector<int>& outColors);
+
+    /**
+     * @brief Builds a stable ordering of constraints grouped by color.
+     *
+     * @param colors Color of each constraint as returned by colorize().
+     * @param outOrder Receives constraint indices sorted by color, keeping insertion order within a color.
+     * @param outBatchOffsets Receives the batch boundaries in @p outOrder; the last batch is
+     * the overflow batch when @c outBatchColors.back() == MaxColors.
+     * @param outBatchColors Receives the color of each non-empty batch.
+     */
+    static void buildBatches(const std::vector<int>& colors,
+                             std::vector<int>& outOrder,
+                             std::vector<int>& outBatchOffsets,
+                             std::vector<int>& outBatchColors);
+
+    /**
+     * @brief Colors a constraint array and reorders it in place so each batch is contiguous.
+     *
+     * Works on arrays of constraint records (anything exposing getParticleIds()) as well
+     * as arrays of owning pointers to virtual constraints.
+     *
+     * @param constraints Constraint array to color and reorder.
+     * @param particleCount Number of particles in the solver.
+     * @param outBatches Receives the batch boundaries of the reordered array.
+     */
+    template<typename T>
+    static void sortByColor(std::vector<T>& constraints, int particleCount, ConstraintBatches& outBatches) {
+        std::vector<int> offsets;
+        std::vector<int> ids;
+        offsets.reserve(constraints.size() + 1);
+        offsets.push_back(0);
+        for (const auto& constraint : constraints) {
+            appendParticleIds(constraint, ids);
+            offsets.push_back(static_cast<int>(ids.size()));
+        }
+
+        std::vector<int> colors;
+        colorize(particleCount, offsets, ids, colors);
+
+        std::vector<int> order;
+        buildBatches(colors, order, outBatches.offsets, outBatches.colors);
+
+        std::vector<T> sorted;
+        sorted.reserve(constraints.size());
+        for (int index : order)
+            sorted.push_back(std::move(constraints[index]));
+        constraints = std::move(sorted);
+    }
+
+private:
+    template<typename T>
+    static void appendParticleIds(const T& constraint, std::vector<int>& ids) { constraint.getParticleIds(ids); }
+
+    template<typename T>
+    static void appendParticleIds(const std::unique_ptr<T>& constraint, std::vector<int>& ids) { constraint->getParticleIds(ids); }
+};
+
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include "math/Scalar.hpp"
+
+namespace ClothSDK {
+
+/**
+ * @struct ConstraintResidual
+ * @brief Running largest and squared constraint error, gathered while projecting.
+ *
+ * The distance and bending projections evaluate C anyway, so when handed one of these
+ * they add the value they are about to correct. The solver reads it after an iteration
+ * to decide whether to stop, without a separate sweep over the constraints.
+ */
+struct ConstraintResidual {
+    Scalar max = 0.0;       ///< Largest |C| seen.
+    Scalar sumSq = 0.0;     ///< Sum of C squared.
+    int count = 0;          ///< Constraints added.
+
+    inline void add(Scalar C) {
+        max = std::max(max, std::abs(C));
+        sumSq += C * C;
+        ++count;
+    }
+
+    inline void merge(const ConstraintResidual& other) {
+        max = std::max(max, other.max);
+        sumSq += other.sumSq;
+        count += other.count;
+    }
+
+    inline Scalar rms() const { return count > 0 ? std::sqrt(sumSq / count) : static_cast<Scalar>(0); }
+};
+
+}
@@ -16,17 +16,24 @@
 
 #pragma once
 
-#include "physics/Constraint.hpp"
+#include "physics/ParticleStore.hpp"
+#include <vector>
+
 namespace ClothSDK {
 
-class ContactConstraint : public Constraint {
-public:
-    ContactConstraint(int idA, int idB, double thickness, double compliance);
-    void solve(std::vector<Particle>& particles, double dt) override;
-private:
-    int m_idA;
-    int m_idB;
-    double m_thickness;
+struct ContactConstraint {
+    int idA;
+    int idB;
+    Scalar thickness;
+    Scalar compliance;
+    Scalar lambda;
+
+    ContactConstraint(int idA, int idB, Scalar thickness, Scalar compliance);
+    void solve(ParticleStore& particles, Scalar dt);
+
+    inline void resetLambda() { lambda = 0.0; }
+    inline void getParticleIds(std::vector<int>& outIds) const { outIds.push_back(idA); outIds.push_back(idB); }
+    inline void remapParticles(const std::vector<int>& newIndex) { idA = newIndex[idA]; idB = newIndex[idB]; }
 };
 
 }
\ No newline at end of file
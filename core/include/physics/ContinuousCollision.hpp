@@ -0,0 +1,76 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "math/Types.hpp"
+
+namespace ClothSDK {
+
+/**
+ * @class ContinuousCollision
+ * @brief Time-of-impact tests for primitives moving linearly over a substep.
+ *
+ * Every vertex moves from its start to its end position as @c x0 + t (x1 - x0) with
+ * @c t in [0, 1]. Four points can only touch when they are coplanar, which is a cubic
+ * in @c t; its roots in [0, 1] are checked in increasing order and the first one at
+ * which the primitives are within @p tolerance of each other is the impact.
+ */
+class ContinuousCollision {
+public:
+    /**
+     * @brief First time at which point p touches triangle (a, b, c).
+     *
+     * @param tolerance Largest distance at the coplanar instant that counts as a touch.
+     * @param outTime Receives the time of impact in [0, 1].
+     * @param outBary Receives the barycentric coordinates of the impact point on the triangle.
+     * @return True when an impact happens during the substep.
+     */
+    static bool vertexTriangle(const Vec3& p0, const Vec3& p1,
+                               const Vec3& a0, const Vec3& a1,
+                               const Vec3& b0, const Vec3& b1,
+                               const Vec3& c0, const Vec3& c1,
+                               Scalar tolerance, Scalar& outTime, Vec3& outBary);
+
+    /**
+     * @brief First time at which segment a-b touches segment c-d.
+     *
+     * @param tolerance Largest distance at the coplanar instant that counts as a touch.
+     * @param outTime Receives the time of impact in [0, 1].
+     * @param outS Receives the impact parameter along a-b.
+     * @param outT Receives the impact parameter along c-d.
+     * @return True when an impact happens during the substep.
+     */
+    static bool edgeEdge(const Vec3& a0, const Vec3& a1,
+                         const Vec3& b0, const Vec3& b1,
+                         const Vec3& c0, const Vec3& c1,
+                         const Vec3& d0, const Vec3& d1,
+                         Scalar tolerance, Scalar& outTime, Scalar& outS, Scalar& outT);
+
+    /**
+     * @brief Roots of c0 + c1 t + c2 t^2 + c3 t^3 in [0, 1].
+     *
+     * The interval is split at the critical points of the cubic and every monotone piece
+     * that changes sign is refined by bisection, so no root is skipped even when two are
+     * close together.
+     *
+     * @param outRoots Receives up to three roots in increasing order.
+     * @return Number of roots found.
+     */
+    static int solveCubic(Scalar c0, Scalar c1, Scalar c2, Scalar c3, Scalar outRoots[3]);
+};
+
+}
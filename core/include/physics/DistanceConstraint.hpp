@@ -16,14 +16,16 @@
 
 #pragma once
 
-#include "Constraint.hpp"
-#include "Particle.hpp"
 #include <vector>
+#include "ConstraintResidual.hpp"
+#include "math/Scalar.hpp"
 
 namespace ClothSDK {
 
+class ParticleStore;
+
 /**
- * @class DistanceConstraint
+ * @struct DistanceConstraint
  * @brief Implementation of a linear constraint using XPBD.
  * 
  * The constraint function is defined as:
@@ -31,9 +33,17 @@ namespace ClothSDK {
  * C(\mathbf{p}_1, \mathbf{p}_2) = |\mathbf{p}_1 - \mathbf{p}_2| - L_{rest}
  * @f]
  * where @f$ L_{rest} @f$ is the natural length of the connection.
+ *
+ * This is a plain record: the solver stores distance constraints by value in a flat
+ * array and projects them without virtual dispatch.
  */
-class DistanceConstraint : public Constraint {
-public:
+struct DistanceConstraint {
+    int idA;                ///< Index of the first particle.
+    int idB;                ///< Index of the second particle.
+    Scalar restLength;      ///< Natural length of the constraint.
+    Scalar compliance;      ///< Physical compliance @f$ \alpha @f$.
+    Scalar lambda;          ///< Accumulated Lagrange multiplier for the current substep.
+
     /**
      * @brief Constructs a distance constraint between two particles.
      * 
@@ -42,7 +52,7 @@ public:
      * @param restLength The target distance the constraint tries to maintain.
      * @param compliance Physical compliance (inverse of the stiffness), measured in m/N.
      */
-    DistanceConstraint(int idA, int idB, double restLength, double compliance);
+    DistanceConstraint(int idA, int idB, Scalar restLength, Scalar compliance);
 
     /**
      * @brief Solves the constraint by updating particle positions and the Lagrange multiplier.
@@ -52,16 +62,19 @@ public:
      * @f]
      * where @f$ \tilde{\alpha} = \frac{\alpha}{\Delta t^2} @f$ is the time-step-corrected compliance.
      *
-     * @param particles Reference to the solver's particle buffer.
+     * @param particles Reference to the solver's particle store.
      * @param dt Current substep time delta.
+     * @param residual When given, receives @f$ C @f$ before the correction; constraints
+     * between immovable particles are left out.
      */
-    void solve(std::vector<Particle>& particles, double dt) override;
+    void solve(ParticleStore& particles, Scalar dt, ConstraintResidual* residual = nullptr);
+
+    /** @return Current value of @f$ C @f$, the stretch beyond the rest length. */
+    Scalar evaluate(const ParticleStore& particles) const;
 
-private:
-    int m_idA;              ///< Index of the first particle.
-    int m_idB;              ///< Index of the second particle.
-    double m_restLength;    ///< Natural length of the constraint.
-    double m_compliance;    ///< Physical compliance @f$ \alpha @f$.
+    inline void resetLambda() { lambda = 0.0; }
+    inline void getParticleIds(std::vector<int>& outIds) const { outIds.push_back(idA); outIds.push_back(idB); }
+    inline void remapParticles(const std::vector<int>& newIndex) { idA = newIndex[idA]; idB = newIndex[idB]; }
 };
 
 }
\ No newline at end of file
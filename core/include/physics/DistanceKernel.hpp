@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "DistanceConstraint.hpp"
+#include "ParticleStore.hpp"
+
+namespace ClothSDK {
+
+/**
+ * @brief Instruction set used by the batched constraint kernels.
+ */
+enum class SimdLevel {
+    Scalar, ///< One constraint at a time through DistanceConstraint::solve.
+    SSE2,   ///< 128-bit lanes.
+    AVX2,   ///< 256-bit lanes with hardware gathers.
+    AVX512  ///< 512-bit lanes with hardware gathers and scatters.
+};
+
+/**
+ * @class DistanceKernel
+ * @brief Batched XPBD projection of independent distance constraints.
+ *
+ * The kernel gathers the endpoints of several constraints into SIMD registers,
+ * evaluates length, @f$ \Delta \lambda @f$ and the corrections for all lanes at once
+ * and scatters the new positions back. It is only valid on batches in which no two
+ * constraints share a particle, i.e. a single color produced by ConstraintColoring.
+ *
+ * Vector code paths are compiled in separate translation units with their own target
+ * flags, and the one to run is chosen at runtime from the CPU features.
+ */
+class DistanceKernel {
+public:
+    /**
+     * @brief Returns the widest instruction set that is both compiled in and supported by the CPU.
+     */
+    static SimdLevel detect();
+
+    /**
+     * @brief Checks whether a level can be used on this build and this CPU.
+     */
+    static bool isSupported(SimdLevel level);
+
+    /** @return Human readable name of a level. */
+    static const char* toString(SimdLevel level);
+
+    /**
+     * @brief Projects a batch of mutually independent distance constraints.
+     *
+     * Lanes that do not fill a whole register fall back to the scalar path, so the
+     * result matches DistanceConstraint::solve up to floating-point rounding.
+     *
+     * @param constraints First constraint of the batch.
+     * @param count Number of constraints in the batch.
+     * @param particles Reference to the solver's particle store.
+     * @param dt Current substep time delta.
+     * @param level Instruction set to use; must satisfy isSupported().
+     * @param residual When given, receives @f$ C @f$ of every projected lane, as
+     * DistanceConstraint::solve reports it.
+     */
+    static void solveBatch(DistanceConstraint* constraints, int count, ParticleStore& particles, Scalar dt, SimdLevel level,
+                           ConstraintResidual* residual = nullptr);
+};
+
+}
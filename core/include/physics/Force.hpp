@@ -16,16 +16,36 @@
 
 #pragma once
 #include <vector>
+#include "math/Types.hpp"
 
 namespace ClothSDK {
 
-class Particle;
+class ParticleStore;
 
 class Force {
 public:
     virtual ~Force() = default;
 
-    virtual void apply(std::vector<Particle>& particles, double dt) = 0;
+    virtual void apply(ParticleStore& particles, Scalar dt) = 0;
+
+    /**
+     * @brief Relabels stored particle indices after the solver reorders its particles.
+     *
+     * @param newIndex New index of every current particle index.
+     */
+    virtual void remapParticles(const std::vector<int>& /*newIndex*/) {}
+
+    /**
+     * @brief Reports a force that is the same for every particle.
+     *
+     * The solver folds such forces into its position prediction instead of calling
+     * apply(), which saves a pass over the particles. The force is scaled by each
+     * particle's inverse mass, exactly as apply() would through addForce().
+     *
+     * @param outForce Receives the force when it is uniform.
+     * @return False for forces that vary per particle; the default.
+     */
+    virtual bool getUniformForce(Vec3& /*outForce*/) const { return false; }
 };
 
 }
\ No newline at end of file
@@ -15,7 +15,7 @@
  */
 
 #include "physics/Force.hpp"
-#include "physics/Particle.hpp"
+#include "physics/ParticleStore.hpp"
 
 #pragma once
 
@@ -23,12 +23,13 @@ namespace ClothSDK {
 
 class GravityForce : public Force {
 public:
-    explicit GravityForce(const Eigen::Vector3d& gravity)
+    explicit GravityForce(const Vec3& gravity)
         : m_gravity(gravity) {}
     
-    void apply(std::vector<Particle>& particles, double dt) override;
+    void apply(ParticleStore& particles, Scalar dt) override;
+    bool getUniformForce(Vec3& outForce) const override { outForce = m_gravity; return true; }
 private:
-    Eigen::Vector3d m_gravity;
+    Vec3 m_gravity;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Collider.hpp"
+#include "physics/TriangleBVH.hpp"
+#include <Eigen/Geometry>
+#include <memory>
+#include <string>
+
+namespace ClothSDK {
+
+/**
+ * @class MeshCollider
+ * @brief Collision volume bounded by a closed triangle mesh.
+ *
+ * The mesh is stored in its local frame with a BVH built once at construction. Each
+ * particle queries the tree with the box of its motion over the substep, so the cost
+ * grows with the number of nearby triangles instead of the mesh size. Inside and
+ * outside are told apart with angle-weighted pseudo-normals, which stay consistent
+ * across edges and vertices of a closed, consistently wound mesh.
+ *
+ * The collider can be moved rigidly with setTransform(); particles are mapped into the
+ * local frame for the query, so the tree is never rebuilt. For animation, a target
+ * transform set with setTargetTransform() is reached at the end of the next frame,
+ * with the rotation slerped and the translation interpolated per substep.
+ */
+class MeshCollider : public Collider {
+public:
+    /**
+     * @brief Constructs a mesh collider from local-space geometry.
+     *
+     * Triangles should be wound counter-clockwise seen from outside. A mesh whose
+     * signed volume is negative is assumed to be wound the other way and is flipped.
+     *
+     * @param vertices Vertex positions in the collider's local frame.
+     * @param triangles Triangles as indices into @p vertices.
+     * @param friction The friction coefficient [0.0 - 1.0] for tangential damping.
+     */
+    MeshCollider(const std::vector<Vec3>& vertices, const std::vector<Triangle>& triangles, Scalar friction);
+
+    /**
+     * @brief Loads a mesh collider from an OBJ file.
+     *
+     * @param path Path of the OBJ file; faces must be triangles.
+     * @param friction The friction coefficient [0.0 - 1.0] for tangential damping.
+     * @return The collider, or nullptr when the file cannot be loaded.
+     */
+    static std::unique_ptr<MeshCollider> fromOBJ(const std::string& path, Scalar friction);
+
+    /**
+     * @brief Projects particles inside the mesh, or closer than the thickness to it, onto
+     * the offset surface and damps their tangential velocity.
+     *
+     * @param particles Reference to the solver's particle store.
+     * @param dt Current substep time delta.
+     * @param thickness Collision margin around the surface.
+     */
+    void resolve(ParticleStore& particles, Scalar dt, Scalar thickness) override;
+    void resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar dt, Scalar thickness) override;
+    bool getBounds(Vec3& outLower, Vec3& outUpper) const override;
+
+    /**
+     * @brief Places the mesh in the world with a rigid transform.
+     *
+     * World positions are @c rotation * local + @c translation. Only the transform is
+     * stored; the BVH keeps its local-space boxes.
+     *
+     * @param rotation Orthonormal rotation matrix.
+     * @param translation World-space translation.
+     */
+    void setTransform(const Mat3& rotation, const Vec3& translation);
+
+    /**
+     * @brief Sets the rigid transform reached at the end of the next Solver::update().
+     *
+     * @param rotation Orthonormal rotation matrix at the end of the frame.
+     * @param translation World-space translation at the end of the frame.
+     */
+    void setTargetTransform(const Mat3& rotation, const Vec3& translation);
+
+    void setFrameTime(Scalar alpha) override;
+    void endFrame() override;
+
+    /**
+     * @brief Signed distance from a local-space point to the surface, negative inside.
+     *
+     * @param point Query point in the collider's local frame.
+     * @param radius Search radius; farther surfaces are not reported.
+     * @param candidates Scratch buffer for the BVH query.
+     * @param outDistance Receives the signed distance.
+     * @return False when no surface lies within @p radius.
+     */
+    bool signedDistance(const Vec3& point, Scalar radius, std::vector<int>& candidates, Scalar& outDistance) const;
+
+    inline const Mat3& getRotation() const { return m_rotation; }
+    inline const Vec3& getTranslation() const { return m_translation; }
+    inline const std::vector<Vec3>& getVertices() const { return m_vertices; }
+    inline const TriangleBVH& getBVH() const { return m_bvh; }
+
+private:
+    void computePseudoNormals();
+    void resolveParticle(Vec3& position, Vec3& oldPosition, const Mat3& toLocal, Scalar thickness,
+                         std::vector<int>& candidates) const;
+    void closestFeature(const Vec3& point, const std::vector<int>& candidates, Vec3& outPoint, Vec3& outNormal) const;
+
+    std::vector<Vec3> m_vertices;       ///< Local-space vertex positions.
+    TriangleBVH m_bvh;
+    std::vector<Vec3> m_faceNormals;
+    std::vector<Vec3> m_edgeNormals;    ///< Three per triangle, for edges ab, bc and ca.
+    std::vector<Vec3> m_vertexNormals;  ///< Angle-weighted.
+    Mat3 m_rotation;
+    Vec3 m_translation;
+    Mat3 m_previousRotation;                    ///< Transform at the start of the current substep.
+    Vec3 m_previousTranslation;
+    Eigen::Quaternion<Scalar> m_frameRotation;  ///< Transform at the start of the current frame.
+    Vec3 m_frameTranslation;
+    Eigen::Quaternion<Scalar> m_targetRotation; ///< Transform at the end of the current frame.
+    Vec3 m_targetTranslation;
+};
+
+}
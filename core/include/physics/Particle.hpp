@@ -17,6 +17,7 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include "math/Types.hpp"
 
 namespace ClothSDK {
 
@@ -33,21 +34,21 @@ public:
      * 
      * @param initialPos Initial world-space position.
      */
-    Particle(const Eigen::Vector3d& initialPos);
+    Particle(const Vec3& initialPos);
 
     /**
      * @brief Accumulates an external force into the particle's state.
      * 
      * @param force Force vector in Newtons.
      */
-    void addForce(const Eigen::Vector3d& force);
+    void addForce(const Vec3& force);
 
     /**
      * @brief Add real mass to the particle and update its inverse mass.
      * 
      * @param mass Amount of mass in kg to add to the current value.
      */
-    void addMass(double mass);
+    void addMass(Scalar mass);
 
     /**
      * @brief Resets the acceleration acumulator to zero.
@@ -59,53 +60,54 @@ public:
      * @brief Updates the particle's position using the Verlet integration scheme.
      * 
      * @param deltaTime The fixed time step for the current update.
+     * @param damping Fraction of the velocity kept over the step.
      */
-    void integrate(double deltaTime);
+    void integrate(Scalar deltaTime, Scalar damping = 0.98);
 
     /**
      * @brief Sets the particle's current position.
      * 
      * @param newPosition The new point in world space.
      */
-    void setPosition(const Eigen::Vector3d& newPosition);
+    void setPosition(const Vec3& newPosition);
 
     /**
      * @brief Set the inverse mass of the particle.
      * 
      * @param invMass The inverse mass value.
      */
-    void setInverseMass(double invMass);
+    void setInverseMass(Scalar invMass);
 
     /**
      * @brief Set the particle's old position.
      * 
      * @param newOldPosition The new point in the world space for the previous state.
      */
-    void setOldPosition(const Eigen::Vector3d& newOldPosition);
+    void setOldPosition(const Vec3& newOldPosition);
 
     /** @return Constant reference to the current position vector. */
-    inline const Eigen::Vector3d& getPosition() const { return m_position; }
+    inline const Vec3& getPosition() const { return m_position; }
 
     /** @return Constant reference to the accumulated acceleration vector. */
-    inline const Eigen::Vector3d& getAcceleration() const { return m_acceleration; }
+    inline const Vec3& getAcceleration() const { return m_acceleration; }
 
     /** @return Constant reference to the previous step's position vector. */
-    inline const Eigen::Vector3d& getOldPosition() const { return m_oldPosition; }
+    inline const Vec3& getOldPosition() const { return m_oldPosition; }
 
     /** @return The current inverse mass value. */
-    inline const double getInverseMass() const { return inverseMass; }
+    inline const Scalar getInverseMass() const { return inverseMass; }
 
     /** @return The derived velocity from Verlet state (m/s). */
-    inline Eigen::Vector3d getVelocity(double dt) const { 
-        if (dt < 1e-7) return Eigen::Vector3d::Zero();
+    inline Vec3 getVelocity(Scalar dt) const { 
+        if (dt < 1e-7) return Vec3::Zero();
         return (m_position - m_oldPosition) / dt; 
     }
 
 private:
-    Eigen::Vector3d m_position;     ///< Current position in 3D world space.
-    Eigen::Vector3d m_oldPosition;  ///< Position from the previous step.
-    Eigen::Vector3d m_acceleration; ///< Force accumulator converted to acceleration.
-    double inverseMass;             ///< Inverse mass.
+    Vec3 m_position;     ///< Current position in 3D world space.
+    Vec3 m_oldPosition;  ///< Position from the previous step.
+    Vec3 m_acceleration; ///< Force accumulator converted to acceleration.
+    Scalar inverseMass;             ///< Inverse mass.
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+namespace ClothSDK {
+
+/**
+ * @class ParticleAdjacency
+ * @brief Topological neighbours of every particle in compressed sparse row form.
+ *
+ * Edges are recorded as constraints are created and turned into one sorted, duplicate
+ * free neighbour row per particle by build(). Self-collision uses the rows to skip pairs
+ * that are already connected by the mesh, optionally extended to the k-ring so that
+ * near neighbours on dense meshes do not produce false contacts.
+ */
+class ParticleAdjacency {
+public:
+    ParticleAdjacency() = default;
+
+    /**
+     * @brief Removes every edge and neighbour row.
+     */
+    void clear();
+
+    /**
+     * @brief Records an undirected edge between two particles.
+     *
+     * @param idA First particle index.
+     * @param idB Second particle index.
+     */
+    void addEdge(int idA, int idB);
+
+    /**
+     * @brief Relabels the recorded edges after the particles have been reordered.
+     *
+     * The neighbour rows are dropped and must be built again.
+     *
+     * @param newIndex New index of every current particle index.
+     */
+    void remap(const std::vector<int>& newIndex);
+
+    /**
+     * @brief Builds the neighbour rows from the recorded edges.
+     *
+     * @param particleCount Number of particles in the solver.
+     * @param rings Neighbourhood depth: 1 keeps direct neighbours, 2 adds their neighbours, and so on.
+     */
+    void build(int particleCount, int rings);
+
+    /**
+     * @brief Checks whether @p idB is within the built neighbourhood of @p idA.
+     *
+     * Rows are short, so a full scan with no early exit is cheaper than a search.
+     */
+    inline bool contains(int idA, int idB) const {
+        bool found = false;
+        for (int k = m_offsets[idA]; k < m_offsets[idA + 1]; ++k)
+            found |= (m_neighbors[k] == idB);
+        return found;
+    }
+
+    /** @return Number of particles covered by the last build. */
+    inline int getParticleCount() const { return m_offsets.empty() ? 0 : static_cast<int>(m_offsets.size()) - 1; }
+
+    /** @return Depth used by the last build. */
+    inline int getRings() const { return m_rings; }
+
+    /** @return Row offsets; the neighbours of particle @c i are [offsets[i], offsets[i+1]). */
+    inline const std::vector<int>& getOffsets() const { return m_offsets; }
+
+    /** @return Flattened neighbour rows, sorted within each row. */
+    inline const std::vector<int>& getNeighbors() const { return m_neighbors; }
+
+private:
+    void buildDirect(int particleCount);
+
+    std::vector<std::pair<int, int>> m_edges;   ///< Edges as recorded, possibly repeated.
+    std::vector<int> m_offsets;
+    std::vector<int> m_neighbors;
+    int m_rings = 1;
+};
+
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "math/Types.hpp"
+#include <vector>
+
+namespace ClothSDK {
+
+/**
+ * @brief Heuristic used to renumber particles for memory locality.
+ */
+enum class ParticleOrderingMethod {
+    Morton,                 ///< Sort by the Z-order curve code of the particle positions.
+    ReverseCuthillMcKee     ///< Breadth-first numbering of the constraint graph, reversed, to minimise its bandwidth.
+};
+
+/**
+ * @class ParticleOrdering
+ * @brief Builds particle permutations that keep neighbouring particles close in memory.
+ *
+ * Every builder writes an @c order array where @c order[k] is the current index of the
+ * particle that should be stored at position @c k. invert() turns it into the
+ * @c newIndex array used to relabel constraint and mesh indices.
+ */
+class ParticleOrdering {
+public:
+    /**
+     * @brief Orders particles along a Morton curve over their bounding box.
+     *
+     * Positions are quantised to 21 bits per axis. Ties keep the original order, so the
+     * result is deterministic.
+     *
+     * @param positions Current particle positions.
+     * @param outOrder Receives the permutation.
+     */
+    static void mortonOrder(const std::vector<Vec3>& positions, std::vector<int>& outOrder);
+
+    /**
+     * @brief Orders particles with reverse Cuthill-McKee on a CSR graph.
+     *
+     * Each connected component is numbered breadth first from its lowest-degree particle,
+     * visiting neighbours by increasing degree, and the whole numbering is then reversed.
+     *
+     * @param offsets Row offsets of the graph, one more than the particle count.
+     * @param neighbors Flattened neighbour rows.
+     * @param outOrder Receives the permutation.
+     */
+    static void reverseCuthillMcKee(const std::vector<int>& offsets, const std::vector<int>& neighbors, std::vector<int>& outOrder);
+
+    /**
+     * @brief Inverts a permutation.
+     *
+     * @param order Permutation from one of the builders.
+     * @param outNewIndex Receives the new index of every current particle index.
+     */
+    static void invert(const std::vector<int>& order, std::vector<int>& outNewIndex);
+
+    /**
+     * @brief Largest index distance between two connected particles.
+     *
+     * @param offsets Row offsets of the graph.
+     * @param neighbors Flattened neighbour rows.
+     * @return Bandwidth of the graph under its current numbering.
+     */
+    static int bandwidth(const std::vector<int>& offsets, const std::vector<int>& neighbors);
+};
+
+}
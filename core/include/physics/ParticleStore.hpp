@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Particle.hpp"
+#include <vector>
+#include <Eigen/Dense>
+
+namespace ClothSDK {
+
+/**
+ * @class ParticleStore
+ * @brief Structure-of-arrays storage for the solver's particle state.
+ *
+ * Each attribute of the particles lives in its own contiguous array, so kernels that
+ * only touch positions (constraints, colliders, the spatial hash) stream through
+ * positions alone instead of striding over whole Particle objects.
+ */
+class ParticleStore {
+public:
+    ParticleStore() = default;
+
+    /**
+     * @brief Appends a particle to the store.
+     *
+     * @param particle Initial state of the particle.
+     * @return Index of the new particle.
+     */
+    int add(const Particle& particle);
+
+    /**
+     * @brief Removes every particle from the store.
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Reserves capacity in every attribute array.
+     *
+     * @param count Number of particles to reserve room for.
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Reorders every attribute array.
+     *
+     * @param order Permutation where @c order[k] is the current index of the particle moved to @c k.
+     */
+    void permute(const std::vector<int>& order);
+
+    /**
+     * @brief Accumulates an external force into a particle's acceleration.
+     *
+     * @param id Particle index.
+     * @param force Force vector in Newtons.
+     */
+    inline void addForce(int id, const Vec3& force) { m_accelerations[id] += force * m_inverseMasses[id]; }
+
+    /**
+     * @brief Add real mass to a particle and update its inverse mass.
+     *
+     * @param id Particle index.
+     * @param mass Amount of mass in kg to add to the current value.
+     */
+    void addMass(int id, Scalar mass);
+
+    /**
+     * @brief Builds an array-of-structures copy of a single particle.
+     *
+     * @param id Particle index.
+     * @return The particle state packed into a Particle object.
+     */
+    Particle getParticle(int id) const;
+
+    /**
+     * @brief Copies the whole store into an array-of-structures buffer.
+     *
+     * @param outParticles Destination buffer, resized to the particle count.
+     */
+    void toParticles(std::vector<Particle>& outParticles) const;
+
+    inline void setPosition(int id, const Vec3& position) { m_positions[id] = position; }
+    inline void setOldPosition(int id, const Vec3& position) { m_oldPositions[id] = position; }
+    inline void setInverseMass(int id, Scalar invMass) { m_inverseMasses[id] = invMass; }
+
+    /** @return Constant reference to the current position of a particle. */
+    inline const Vec3& getPosition(int id) const { return m_positions[id]; }
+
+    /** @return Constant reference to the previous step's position of a particle. */
+    inline const Vec3& getOldPosition(int id) const { return m_oldPositions[id]; }
+
+    /** @return Constant reference to the accumulated acceleration of a particle. */
+    inline const Vec3& getAcceleration(int id) const { return m_accelerations[id]; }
+
+    /** @return The current inverse mass of a particle. */
+    inline Scalar getInverseMass(int id) const { return m_inverseMasses[id]; }
+
+    /** @return The derived velocity from Verlet state (m/s). */
+    inline Vec3 getVelocity(int id, Scalar dt) const {
+        if (dt < 1e-7) return Vec3::Zero();
+        return (m_positions[id] - m_oldPositions[id]) / dt;
+    }
+
+    inline int size() const { return static_cast<int>(m_positions.size()); }
+    inline bool empty() const { return m_positions.empty(); }
+
+    /** @name Raw attribute arrays for bulk kernels. */
+    ///@{
+    inline std::vector<Vec3>& getPositions() { return m_positions; }
+    inline const std::vector<Vec3>& getPositions() const { return m_positions; }
+    inline std::vector<Vec3>& getOldPositions() { return m_oldPositions; }
+    inline const std::vector<Vec3>& getOldPositions() const { return m_oldPositions; }
+    inline std::vector<Vec3>& getAccelerations() { return m_accelerations; }
+    inline const std::vector<Vec3>& getAccelerations() const { return m_accelerations; }
+    inline const std::vector<Scalar>& getInverseMasses() const { return m_inverseMasses; }
+    ///@}
+
+private:
+    std::vector<Vec3> m_positions;       ///< Current positions in world space.
+    std::vector<Vec3> m_oldPositions;    ///< Positions from the previous step.
+    std::vector<Vec3> m_accelerations;   ///< Force accumulators converted to acceleration.
+    std::vector<Scalar> m_inverseMasses;            ///< Inverse masses.
+};
+
+}
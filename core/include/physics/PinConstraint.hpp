@@ -16,19 +16,25 @@
 
 #pragma once
 
-#include "physics/Constraint.hpp"
+#include "physics/ParticleStore.hpp"
+#include <vector>
+#include <Eigen/Dense>
+
 namespace ClothSDK {
 
-class PinConstraint : public Constraint {
-public:
-    PinConstraint(int particleId, const Eigen::Vector3d& pinPosition, double compliance);
-    void solve(std::vector<Particle>& particles, double dt) override;
+struct PinConstraint {
+    int particleId;
+    Vec3 pinPosition;
+    Scalar compliance;
+    Scalar lambda;
 
-    inline void setPinPosition(const Eigen::Vector3d& newPos) { m_pinPos = newPos; }
+    PinConstraint(int particleId, const Vec3& pinPosition, Scalar compliance);
+    void solve(ParticleStore& particles, Scalar dt);
 
-private:
-    int m_particleId;     
-    Eigen::Vector3d m_pinPos;
+    inline void setPinPosition(const Vec3& newPos) { pinPosition = newPos; }
+    inline void resetLambda() { lambda = 0.0; }
+    inline void getParticleIds(std::vector<int>& outIds) const { outIds.push_back(particleId); }
+    inline void remapParticles(const std::vector<int>& newIndex) { particleId = newIndex[particleId]; }
 };
 
 }
\ No newline at end of file
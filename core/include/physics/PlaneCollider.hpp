@@ -38,7 +38,7 @@ public:
      * @param normal A vector defining the collision side of the plane.
      * @param friction The friction coefficient [0.0 - 1.0] for tangential damping.
      */
-    PlaneCollider(const Eigen::Vector3d& origin, const Eigen::Vector3d& normal, double friction);
+    PlaneCollider(const Vec3& origin, const Vec3& normal, Scalar friction);
     
     /**
      * @brief Projects penetrating particles onto the plane's surface.
@@ -47,14 +47,17 @@ public:
      * If the distance is less than the collision thickness, the particle is 
      * translated along the normal and its implicit velocity is damped.
      * 
-     * @param particles Reference to the global particle buffer.
+     * @param particles Reference to the solver's particle store.
      * @param dt Current substep time delta.
      */
-    void resolve(std::vector<Particle>& particles, double dt, double thickness);
+    void resolve(ParticleStore& particles, Scalar dt, Scalar thickness) override;
+    void resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar dt, Scalar thickness) override;
 
 private:
-    Eigen::Vector3d m_origin;   ///< World-space coordinate of a point in the plane.  
-    Eigen::Vector3d m_normal;   ///< Normalized vector defining the surface orientation.
+    void resolveParticle(Vec3& position, Vec3& oldPosition, Scalar thickness) const;
+
+    Vec3 m_origin;   ///< World-space coordinate of a point in the plane.  
+    Vec3 m_normal;   ///< Normalized vector defining the surface orientation.
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "math/Types.hpp"
+#include <algorithm>
+
+namespace ClothSDK {
+
+/**
+ * @class Proximity
+ * @brief Closest-point queries between points, segments and triangles.
+ *
+ * These are the narrow-phase primitives of triangle-based collision. They are inline
+ * because they run once per candidate pair in the innermost collision loops.
+ */
+class Proximity {
+public:
+    /**
+     * @brief Closest point of triangle (a, b, c) to point p.
+     *
+     * Uses the Voronoi region classification from Ericson, Real-Time Collision Detection.
+     *
+     * @param outBary Receives the barycentric weights of the closest point for a, b and c.
+     * @return The closest point on the triangle.
+     */
+    static inline Vec3 closestPointOnTriangle(const Vec3& p, const Vec3& a, const Vec3& b, const Vec3& c, Vec3& outBary) {
+        const Vec3 ab = b - a;
+        const Vec3 ac = c - a;
+        const Vec3 ap = p - a;
+        const Scalar d1 = ab.dot(ap);
+        const Scalar d2 = ac.dot(ap);
+        if (d1 <= 0.0 && d2 <= 0.0) { outBary = Vec3(1.0, 0.0, 0.0); return a; }
+
+        const Vec3 bp = p - b;
+        const Scalar d3 = ab.dot(bp);
+        const Scalar d4 = ac.dot(bp);
+        if (d3 >= 0.0 && d4 <= d3) { outBary = Vec3(0.0, 1.0, 0.0); return b; }
+
+        const Scalar vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+            const Scalar v = d1 / (d1 - d3);
+            outBary = Vec3(1.0 - v, v, 0.0);
+            return a + ab * v;
+        }
+
+        const Vec3 cp = p - c;
+        const Scalar d5 = ab.dot(cp);
+        const Scalar d6 = ac.dot(cp);
+        if (d6 >= 0.0 && d5 <= d6) { outBary = Vec3(0.0, 0.0, 1.0); return c; }
+
+        const Scalar vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+            const Scalar w = d2 / (d2 - d6);
+            outBary = Vec3(1.0 - w, 0.0, w);
+            return a + ac * w;
+        }
+
+        const Scalar va = d3 * d6 - d5 * d4;
+        if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+            const Scalar w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            outBary = Vec3(0.0, 1.0 - w, w);
+            return b + (c - b) * w;
+        }
+
+        const Scalar denom = 1.0 / (va + vb + vc);
+        const Scalar v = vb * denom;
+        const Scalar w = vc * denom;
+        outBary = Vec3(1.0 - v - w, v, w);
+        return a + ab * v + ac * w;
+    }
+
+    /**
+     * @brief Closest points between segments p1-q1 and p2-q2.
+     *
+     * @param outS Receives the parameter of the closest point on the first segment.
+     * @param outT Receives the parameter of the closest point on the second segment.
+     * @return Squared distance between the closest points.
+     */
+    static inline Scalar closestPointsOnSegments(const Vec3& p1, const Vec3& q1, const Vec3& p2, const Vec3& q2,
+                                                 Scalar& outS, Scalar& outT) {
+        const Scalar epsilon = 1e-12;
+        const Vec3 d1 = q1 - p1;
+        const Vec3 d2 = q2 - p2;
+        const Vec3 r = p1 - p2;
+        const Scalar a = d1.squaredNorm();
+        const Scalar e = d2.squaredNorm();
+        const Scalar f = d2.dot(r);
+
+        Scalar s = 0.0;
+        Scalar t = 0.0;
+        if (a <= epsilon && e <= epsilon) {
+            outS = outT = 0.0;
+            return r.squaredNorm();
+        }
+        if (a <= epsilon) {
+            t = std::clamp(f / e, Scalar(0.0), Scalar(1.0));
+        } else {
+            const Scalar c = d1.dot(r);
+            if (e <= epsilon) {
+                s = std::clamp(-c / a, Scalar(0.0), Scalar(1.0));
+            } else {
+                const Scalar b = d1.dot(d2);
+                const Scalar denom = a * e - b * b;
+                if (denom > epsilon)
+                    s = std::clamp((b * f - c * e) / denom, Scalar(0.0), Scalar(1.0));
+
+                t = (b * s + f) / e;
+                if (t < 0.0) {
+                    t = 0.0;
+                    s = std::clamp(-c / a, Scalar(0.0), Scalar(1.0));
+                } else if (t > 1.0) {
+                    t = 1.0;
+                    s = std::clamp((b - c) / a, Scalar(0.0), Scalar(1.0));
+                }
+            }
+        }
+
+        outS = s;
+        outT = t;
+        return ((p1 + d1 * s) - (p2 + d2 * t)).squaredNorm();
+    }
+};
+
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Collider.hpp"
+#include <memory>
+#include <string>
+
+namespace ClothSDK {
+
+class MeshCollider;
+
+/**
+ * @class SDFCollider
+ * @brief Static collision volume described by a signed distance grid.
+ *
+ * A closed mesh is baked once into a dense grid of signed distances sampled at the
+ * cell corners, negative inside. Distances are exact within a narrow band around the
+ * surface and clamped to the band width beyond it, with the sign of far samples found
+ * by flooding the outside from the grid border. A particle query is a single trilinear
+ * lookup plus its analytic gradient, so the cost does not depend on the mesh size.
+ *
+ * Baking is the expensive part; save() and load() cache the grid on disk.
+ */
+class SDFCollider : public Collider {
+public:
+    /**
+     * @brief Bakes a closed mesh into a distance grid.
+     *
+     * A non-positive cell size, or one that would need more than 2^27 samples, is
+     * logged and leaves the grid empty, so the collider never touches a particle.
+     *
+     * @param mesh Mesh to bake, sampled in its local frame.
+     * @param cellSize Grid spacing in world units.
+     * @param bandCells Width of the exact narrow band, in cells.
+     * @param friction The friction coefficient [0.0 - 1.0] for tangential damping.
+     */
+    SDFCollider(const MeshCollider& mesh, Scalar cellSize, int bandCells, Scalar friction);
+
+    /**
+     * @brief Loads an OBJ file and bakes it.
+     *
+     * @return The collider, or nullptr when the file cannot be loaded.
+     */
+    static std::unique_ptr<SDFCollider> fromOBJ(const std::string& path, Scalar cellSize, int bandCells, Scalar friction);
+
+    /**
+     * @brief Loads a grid written by save().
+     *
+     * @return The collider, or nullptr when the file is missing or not a grid cache.
+     */
+    static std::unique_ptr<SDFCollider> load(const std::string& path, Scalar friction);
+
+    /**
+     * @brief Writes the baked grid to a binary cache file.
+     *
+     * @return True on success.
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Projects particles closer than the thickness to the surface along the
+     * distance gradient and damps their tangential velocity.
+     *
+     * Particles outside the grid, or deeper inside than the band, are left untouched:
+     * the clamped distances there have no gradient to push along. A particle that gets
+     * more than bandCells deep within one substep therefore stays inside, so the band
+     * should cover the deepest expected penetration.
+     *
+     * @param particles Reference to the solver's particle store.
+     * @param dt Current substep time delta.
+     * @param thickness Collision margin around the surface.
+     */
+    void resolve(ParticleStore& particles, Scalar dt, Scalar thickness) override;
+    void resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar dt, Scalar thickness) override;
+    bool getBounds(Vec3& outLower, Vec3& outUpper) const override;
+
+    /**
+     * @brief Trilinear signed distance and its gradient at a world-space point.
+     *
+     * @param point Query point.
+     * @param outGradient Receives the gradient of the interpolated distance.
+     * @return The signed distance, or the band width outside the grid.
+     */
+    Scalar sample(const Vec3& point, Vec3& outGradient) const;
+
+    inline const Vec3& getOrigin() const { return m_origin; }
+    inline Scalar getCellSize() const { return m_cellSize; }
+    inline Scalar getBandWidth() const { return m_band; }
+    inline int getResolution(int axis) const { return m_resolution[axis]; }
+
+private:
+    SDFCollider() = default;
+
+    void resolveParticle(Vec3& position, Vec3& oldPosition, Scalar thickness) const;
+
+    inline int index(int x, int y, int z) const { return (z * m_resolution[1] + y) * m_resolution[0] + x; }
+
+    Vec3 m_origin = Vec3::Zero();   ///< World position of sample (0, 0, 0).
+    Scalar m_cellSize = 1.0;
+    Scalar m_band = 0.0;            ///< Distances are clamped to [-m_band, m_band].
+    int m_resolution[3] = { 0, 0, 0 };  ///< Samples per axis.
+    std::vector<float> m_distances;     ///< x-fastest sample values.
+};
+
+}
@@ -17,16 +17,84 @@
 #pragma once
 
 #include "Particle.hpp"  
+#include "ParticleStore.hpp"
 #include "Constraint.hpp"
+#include "DistanceConstraint.hpp"
+#include "BendingConstraint.hpp"
+#include "PinConstraint.hpp"
+#include "AttachmentConstraint.hpp"
+#include "ContactConstraint.hpp"
+#include "ConstraintColoring.hpp"
+#include "ParticleAdjacency.hpp"
+#include "ParticleOrdering.hpp"
+#include "DistanceKernel.hpp"
 #include "SpatialHash.hpp"
+#include "TriangleBVH.hpp"
 #include "engine/World.hpp" 
-#include <unordered_set>
 #include <vector>
 #include <memory>
 #include <Eigen/Dense>
 
 namespace ClothSDK {
 
+/**
+ * @brief Strategy used to project the constraint set on every iteration.
+ */
+enum class ConstraintSolveMode {
+    Sequential, ///< Single-threaded Gauss-Seidel sweep over the stored constraint order.
+    Colored     ///< Graph-colored batches; each batch is projected in parallel.
+};
+
+/**
+ * @brief Strategy used to resolve particle-particle self-collisions.
+ */
+enum class SelfCollisionMode {
+    Sequential, ///< Single-threaded pass that corrects both particles of a pair as soon as it is found.
+    Parallel    ///< Pairs are found in parallel, then each particle applies the average of its corrections (Jacobi).
+};
+
+/**
+ * @brief How self-collision finds candidate particle pairs.
+ */
+enum class SelfCollisionBackend {
+    SpatialHash,    ///< Query the spatial hash around every particle on every substep.
+    VerletList,     ///< Reuse a cached pair list built with a padded radius until particles move more than half the skin.
+    TriangleBVH     ///< Vertex-triangle and edge-edge proximity against a refitted BVH over the world's cloth triangles.
+};
+
+/**
+ * @brief When the self-collision spatial hash is rebuilt.
+ */
+enum class HashRebuildPolicy {
+    PerFrame,       ///< Once at the start of every update() call.
+    EverySubstep,   ///< After position prediction in every substep.
+    EveryNSubsteps, ///< After position prediction once every N substeps (see Solver::setHashRebuildInterval).
+    Displacement    ///< When particles may have moved more than a fraction of the cell size since the last build.
+};
+
+/**
+ * @brief Acceleration applied on top of every constraint iteration.
+ */
+enum class IterationAcceleration {
+    None,           ///< Plain iterations.
+    OverRelaxation, ///< The position change of each iteration is scaled by a fixed omega.
+    Chebyshev       ///< Each iterate is extrapolated from the one before last with the Chebyshev weight sequence.
+};
+
+/**
+ * @brief Convergence and stepping figures of the last Solver::update() call.
+ */
+struct FrameStats {
+    int substeps = 0;               ///< Substeps taken.
+    int iterations = 0;             ///< Constraint iterations summed over all substeps.
+    Scalar residualMax = 0;         ///< Largest |C| over movable distance and bending constraints at the end of the frame.
+    Scalar residualRms = 0;         ///< Root mean square of C over the same constraints.
+    Scalar maxSpeed = 0;            ///< Fastest particle speed over the last substep.
+    Scalar maxPenetration = 0;      ///< Largest collision correction of any substep; only measured with adaptive substeps.
+    int activeParticles = 0;        ///< Particles of awake islands at the end of the frame; all of them unless sleeping is on.
+    int sleepingIslands = 0;        ///< Islands asleep at the end of the frame.
+};
+
 class Solver {
 public:
     Solver();
@@ -34,43 +102,502 @@ public:
     int addParticle(const Particle& p);
     void clear();
     const std::vector<Particle>& getParticles() const;
-    void setParticleInverseMass(int id, double invMass);
-    void addMassToParticle(int id, double mass);
+    inline const ParticleStore& getParticleStore() const { return m_particles; }
+    void setParticleInverseMass(int id, Scalar invMass);
+    void addMassToParticle(int id, Scalar mass);
 
     void setSubsteps(int count);
     void setIterations(int count); 
-    void setCollisionCompliance(double c) { m_collisionCompliance = c; }
+    void setCollisionCompliance(Scalar c) { m_collisionCompliance = c; }
+
+    /**
+     * @brief Sets the fraction of each particle's velocity kept from one substep to the next.
+     *
+     * @param damping Velocity retention factor, 0.98 by default; 1 disables damping.
+     */
+    inline void setDamping(Scalar damping) { m_damping = damping; }
+
+    /**
+     * @brief Stops the constraint iterations of a substep once the residual is small enough.
+     *
+     * The distance and bending projections report the |C| they correct, and once the
+     * largest of an iteration past the minimum falls below @p tolerance the remaining
+     * iterations are skipped. setIterations() sets the upper bound. Gathering the values
+     * costs a compare and an add per constraint and no extra pass, but they describe the
+     * iterate an iteration started from, so the exit comes one iteration after the
+     * iterate converged. Compliant constraints under load keep a residual of their own,
+     * so the tolerance should sit above it.
+     *
+     * @param tolerance Residual in world units (radians for bending); 0 disables the early exit.
+     */
+    inline void setResidualTolerance(Scalar tolerance) { m_residualTolerance = tolerance; }
+
+    /**
+     * @brief Sets the acceleration scheme of the constraint iterations.
+     *
+     * Both schemes act on whole iterations, after every constraint has been projected
+     * once, so they work with the sequential and the colored solve modes alike. They
+     * reach a given stiffness in fewer iterations, but too large an omega or spectral
+     * radius makes the iterations overshoot and can add energy.
+     *
+     * @param mode Acceleration scheme; IterationAcceleration::None by default.
+     */
+    inline void setIterationAcceleration(IterationAcceleration mode) { m_acceleration = mode; }
+
+    /** @param omega Scale of each iteration's change under OverRelaxation, in (0, 2); 1.5 by default. */
+    inline void setOverRelaxation(Scalar omega) { m_overRelaxation = omega; }
+
+    /**
+     * @brief Sets the spectral radius estimate driving the Chebyshev weights.
+     *
+     * The first two iterations are plain; the third is weighted 2 / (2 - rho^2) and
+     * later ones 4 / (4 - rho^2 omega), tending to 2 as rho approaches 1. Chebyshev
+     * therefore needs at least three iterations per substep to have any effect.
+     *
+     * @param rho Estimated convergence rate of the plain iterations, in [0, 1); 0.9 by default.
+     */
+    inline void setSpectralRadius(Scalar rho) { m_spectralRadius = rho; }
+
+    /** @param count Iterations run before the residual is first checked, clamped to at least 1. */
+    void setMinIterations(int count);
+
+    /**
+     * @brief Chooses the substep count of every frame from the motion of the last one.
+     *
+     * The count is the smallest that keeps the fastest particle within
+     * setMaxSubstepMotion() of the thickness per substep, at least doubled after a frame
+     * whose collision passes corrected a particle by more than that, and clamped to
+     * setSubstepRange(). Carried velocities are rescaled when the substep length changes.
+     * setSubsteps() is used while disabled, which is the default.
+     *
+     * @param enabled True to adapt the substep count.
+     */
+    inline void setAdaptiveSubsteps(bool enabled) { m_adaptiveSubsteps = enabled; }
+
+    /** @brief Sets the bounds of the adaptive substep count; @p minCount is clamped to at least 1. */
+    void setSubstepRange(int minCount, int maxCount);
+
+    /** @param fraction Largest motion per substep as a fraction of the thickness, 0.5 by default. */
+    inline void setMaxSubstepMotion(Scalar fraction) { m_substepMotionFraction = fraction; }
+    /**
+     * @brief Selects how the constraints are projected.
+     *
+     * Sequential by default. Colored mode projects independent batches in parallel, which
+     * changes the projection order and therefore the results of existing scenes.
+     *
+     * @param mode Projection strategy.
+     */
+    void setConstraintSolveMode(ConstraintSolveMode mode);
+    /**
+     * @brief Selects how particle-particle contacts are resolved by the spatial hash backend.
+     *
+     * Sequential by default. The parallel Jacobi pass averages the corrections of each
+     * particle, so its contact results differ from the sequential pass.
+     *
+     * @param mode Resolution strategy.
+     */
+    inline void setSelfCollisionMode(SelfCollisionMode mode) { m_selfCollisionMode = mode; }
+
+    /**
+     * @brief Sets how far along the mesh topology self-collision ignores particle pairs.
+     *
+     * With 1 (the default) only particles that share a constraint are skipped. Larger
+     * values also skip neighbours of neighbours, which removes false contacts on dense
+     * meshes whose rest spacing is below the collision thickness.
+     *
+     * @param rings Neighbourhood depth, clamped to at least 1.
+     */
+    void setSelfCollisionExclusionRings(int rings);
+
+    inline void setSelfCollisionBackend(SelfCollisionBackend backend) { m_selfCollisionBackend = backend; }
+
+    /**
+     * @brief Sets the padding added to the thickness when building the Verlet pair list.
+     *
+     * A larger skin keeps the list valid for more substeps at the cost of more candidate
+     * pairs to test. The candidate lists of continuous collision use the same skin.
+     *
+     * @param skin Padding distance in world units.
+     */
+    void setVerletSkin(Scalar skin);
+
+    inline void setHashRebuildPolicy(HashRebuildPolicy policy) { m_hashRebuildPolicy = policy; }
+
+    /**
+     * @brief Sets N for HashRebuildPolicy::EveryNSubsteps.
+     *
+     * @param substeps Number of substeps between rebuilds, clamped to at least 1.
+     */
+    void setHashRebuildInterval(int substeps);
+
+    /**
+     * @brief Sets the trigger of HashRebuildPolicy::Displacement.
+     *
+     * The hash is rebuilt once the largest particle displacement since the last build
+     * may exceed @p fraction times the cell size. The displacement is a conservative
+     * bound accumulated from the largest per-substep motion seen in predictPositions().
+     *
+     * @param fraction Fraction of the cell size, e.g. 0.25.
+     */
+    inline void setHashRebuildDisplacement(Scalar fraction) { m_hashRebuildFraction = fraction; }
+
+    /**
+     * @brief Enables continuous collision detection between cloth triangles.
+     *
+     * After the discrete collision passes of every substep, vertex-triangle and edge-edge
+     * trajectories from the substep start to the projected positions are tested for
+     * impacts, and every impact is pushed back to the side it started on, one thickness
+     * away. Catches tunnelling that discrete proximity misses at low substep counts.
+     * Candidate pairs are cached like the Verlet list and rebuilt once a particle moves
+     * more than half the Verlet skin.
+     *
+     * @param enabled True to run the continuous stage; off by default.
+     */
+    inline void setContinuousCollision(bool enabled) { m_continuousCollision = enabled; }
+
+    /**
+     * @brief Enables the collider broad phase.
+     *
+     * Particles are binned once per substep and each collider with finite bounds only
+     * resolves the particles inside its box padded by the thickness. Unbounded colliders
+     * such as planes always run a full pass. Results match the full passes; on by default.
+     *
+     * @param enabled False to run every collider over every particle.
+     */
+    inline void setColliderBroadPhase(bool enabled) { m_colliderBroadPhase = enabled; }
+
+    /**
+     * @brief Enables long-range attachments to the pinned particles.
+     *
+     * Every free particle reachable through distance constraints from a pin or an
+     * immovable particle is kept within its geodesic rest distance of the nearest one,
+     * found with Dijkstra over the constraint graph. The attachments are regenerated
+     * before the next update whenever pins, distance constraints or inverse masses
+     * change, and are projected after the pins on every iteration. Stops hanging cloth
+     * from stretching at low iteration counts; off by default.
+     *
+     * @param enabled True to generate and solve the attachments.
+     */
+    void setLongRangeAttachments(bool enabled);
+
+    /**
+     * @brief Enables sleeping of cloth pieces that have come to rest.
+     *
+     * Particles are grouped into islands, the connected components of the distance and
+     * bending constraints. An island whose kinetic energy per movable particle stays
+     * below setSleepThreshold() for setSleepFrames() consecutive frames falls asleep:
+     * its velocities are zeroed, its particles are left out of prediction and of
+     * unbounded colliders such as planes, and constraints whose particles all sleep are
+     * set aside; get*Constraints() still lists them. Sleeping particles still
+     * take part in self-collision and bounded colliders. An island wakes up when one of
+     * these moves a particle by more than 1% of the thickness, when a force would move
+     * one by as much within a substep, or when the uniform forces change. Off by default.
+     *
+     * @param enabled True to let islands fall asleep.
+     */
+    void setSleeping(bool enabled);
+
+    /** @param energy Kinetic energy per movable particle below which an island is at rest, 1e-6 by default. */
+    inline void setSleepThreshold(Scalar energy) { m_sleepThreshold = energy; }
+
+    /** @param frames Consecutive frames at rest before an island sleeps, clamped to at least 1; 30 by default. */
+    void setSleepFrames(int frames);
+
+    /**
+     * @brief Selects the instruction set of the batched distance kernel.
+     *
+     * Defaults to the widest level detected at construction. Levels not supported by
+     * this build or CPU fall back to the detected one. Only used in colored mode.
+     *
+     * @param level Requested instruction set.
+     */
+    void setSimdLevel(SimdLevel level);
     
     inline int getSubsteps() const { return m_substeps; }
     inline int getIterations() const { return m_iterations; }
-    inline double getCollisionCompliance() const { return m_collisionCompliance; }
+    inline Scalar getCollisionCompliance() const { return m_collisionCompliance; }
+    inline Scalar getDamping() const { return m_damping; }
+    inline IterationAcceleration getIterationAcceleration() const { return m_acceleration; }
+    inline Scalar getOverRelaxation() const { return m_overRelaxation; }
+    inline Scalar getSpectralRadius() const { return m_spectralRadius; }
+    inline Scalar getResidualTolerance() const { return m_residualTolerance; }
+    inline int getMinIterations() const { return m_minIterations; }
+    inline bool isAdaptiveSubstepsEnabled() const { return m_adaptiveSubsteps; }
+    inline int getMinSubsteps() const { return m_minSubsteps; }
+    inline int getMaxSubsteps() const { return m_maxSubsteps; }
+    inline Scalar getMaxSubstepMotion() const { return m_substepMotionFraction; }
+    /** @return Substeps, iterations and residual of the last update() call. */
+    inline const FrameStats& getFrameStats() const { return m_frameStats; }
     inline int getParticleCount() const { return static_cast<int>(m_particles.size()); }
+    inline ConstraintSolveMode getConstraintSolveMode() const { return m_constraintMode; }
+    inline SelfCollisionMode getSelfCollisionMode() const { return m_selfCollisionMode; }
+    inline int getSelfCollisionExclusionRings() const { return m_exclusionRings; }
+    inline SelfCollisionBackend getSelfCollisionBackend() const { return m_selfCollisionBackend; }
+    inline Scalar getVerletSkin() const { return m_verletSkin; }
+    inline int getVerletPairCount() const { return static_cast<int>(m_verletPairs.size()); }
+    /** @return Number of Verlet pair list builds since construction. */
+    inline int getVerletBuildCount() const { return m_verletBuildCount; }
+    inline HashRebuildPolicy getHashRebuildPolicy() const { return m_hashRebuildPolicy; }
+    inline int getHashRebuildInterval() const { return m_hashRebuildInterval; }
+    inline Scalar getHashRebuildDisplacement() const { return m_hashRebuildFraction; }
+    /** @return Number of spatial hash builds since construction. */
+    inline int getHashBuildCount() const { return m_hashBuildCount; }
+    inline const ParticleAdjacency& getAdjacency() const { return m_adjacency; }
+    /** @return BVH over the cloth triangles, built when the TriangleBVH backend is active. */
+    inline const TriangleBVH& getTriangleBVH() const { return m_triangleBVH; }
+    inline SimdLevel getSimdLevel() const { return m_simdLevel; }
+    inline bool isContinuousCollisionEnabled() const { return m_continuousCollision; }
+    /** @return Number of continuous impacts resolved during the last update() call. */
+    inline int getContinuousImpactCount() const { return m_impactCount; }
+    inline bool isColliderBroadPhaseEnabled() const { return m_colliderBroadPhase; }
+    inline bool isLongRangeAttachmentsEnabled() const { return m_longRangeAttachments; }
+    inline bool isSleepingEnabled() const { return m_sleeping; }
+    inline Scalar getSleepThreshold() const { return m_sleepThreshold; }
+    inline int getSleepFrames() const { return m_sleepFrames; }
+    /** @return Number of islands, valid after the first update() with sleeping enabled. */
+    inline int getIslandCount() const { return static_cast<int>(m_islandAsleep.size()); }
+    /** @return True when the particle at store index @p id belongs to a sleeping island. */
+    inline bool isParticleSleeping(int id) const { return m_sleeping && !m_islandsDirty && m_islandAsleep[m_particleIslands[id]]; }
+    int getConstraintBatchCount() const;
+
+    void addDistanceConstraint(int idA, int idB, Scalar compliance);
+    void addBendingConstraint(int a, int b, int c, int d, Scalar restAngle, Scalar compliance);
+    void addPin(int id, const Vec3& pos, Scalar compliance = 0.0);
+    void addContactConstraint(int idA, int idB, Scalar thickness, Scalar compliance);
+
+    /**
+     * @brief Registers a user-defined constraint.
+     *
+     * Built-in constraint types are stored by value in per-type arrays; this is the
+     * extension path for custom constraints, which are projected through Constraint::solve
+     * after all built-in types.
+     *
+     * @param constraint The constraint to take ownership of.
+     */
+    void addConstraint(std::unique_ptr<Constraint> constraint);
+
+    /**
+     * @brief Every distance constraint, including those set aside for sleeping islands.
+     *
+     * The order follows the solver's internal layout and changes with coloring and
+     * sleeping. While islands sleep the list is assembled into a buffer that stays valid
+     * until the next call.
+     */
+    const std::vector<DistanceConstraint>& getDistanceConstraints() const;
+    /** @brief Every bending constraint; see getDistanceConstraints(). */
+    const std::vector<BendingConstraint>& getBendingConstraints() const;
+    /** @brief Every pin; see getDistanceConstraints(). */
+    const std::vector<PinConstraint>& getPinConstraints() const;
+    /** @return Long-range attachments generated for the last update() call. */
+    inline const std::vector<AttachmentConstraint>& getAttachmentConstraints() const { return m_attachmentConstraints; }
 
-    void addDistanceConstraint(int idA, int idB, double compliance);
-    void addBendingConstraint(int a, int b, int c, int d, double restAngle, double compliance);
-    void addPin(int id, const Eigen::Vector3d& pos, double compliance = 0.0);
+    /**
+     * @brief Renumbers the particles so that neighbours sit close together in memory.
+     *
+     * Permutes the particle store and remaps every constraint, the adjacency, and the
+     * particle indices held by the world's cloths and forces. Indices returned by
+     * addParticle() before the call are external IDs afterwards; translate them with
+     * getInternalIndex(). Custom constraints must implement Constraint::remapParticles().
+     *
+     * @param world World whose cloths and forces reference the solver's particles.
+     * @param method Ordering heuristic.
+     */
+    void reorderParticles(World& world, ParticleOrderingMethod method);
 
-    void update(World& world, double deltaTime);
+    /** @return Current store index of the particle that addParticle() returned as @p externalId. */
+    inline int getInternalIndex(int externalId) const { return m_externalToInternal[externalId]; }
+
+    /** @return ID originally returned by addParticle() for the particle stored at @p internalIndex. */
+    inline int getExternalIndex(int internalIndex) const { return m_internalToExternal[internalIndex]; }
+
+    void update(World& world, Scalar deltaTime);
 
 private:
-    void step(World& world, double dt);
-    void applyForces(World& world, double dt);
-    void solveSelfCollisions(double dt, double thickness); 
+    void step(World& world, Scalar dt, bool firstSubstep);
+    void applyForces(World& world, Scalar dt);
+    void solveSelfCollisions(Scalar dt, Scalar thickness); 
+    void solveSelfCollisionsSequential(Scalar dt, Scalar thickness);
+    void solveSelfCollisionsParallel(Scalar dt, Scalar thickness);
+    void solveVerletPairs(Scalar dt, Scalar thickness);
+    void updateVerletList(Scalar thickness);
+    void gatherThreadContacts();
+    void applySelfContacts();
+    void updateTriangleTopology(const World& world);
+    void solveTriangleCollisions(Scalar dt, Scalar thickness);
+    void applyTriangleContacts();
+    void updateImpactCandidates(Scalar tolerance);
+    void solveContinuousCollisions(Scalar thickness);
+
+    /** @return True when self-collision ignores the pair because of the mesh topology. */
+    inline bool isTopologicallyClose(int a, int b) const { return a == b || m_adjacency.contains(a, b); }
 
-    void predictPositions(double dt);
-    void solveConstraints(double dt); 
-    uint64_t getAdjacencyKey(int idA, int idB) const;
+    void resolveColliders(const World& world, Scalar dt);
+    void predictPositions(Scalar dt);
+    void solveConstraints(Scalar dt, ConstraintResidual* residual); 
+    void relaxIterate(const std::vector<Vec3>& base, Scalar omega);
+    void measureResidual(Scalar& maxResidual, Scalar& rmsResidual) const;
+    int chooseSubstepCount(Scalar deltaTime, Scalar thickness) const;
+    void buildConstraintColoring();
+    void buildAttachments();
+    void solveAttachments();
+    void buildIslands();
+    void updateSleep(Scalar dt, Scalar thickness);
+    void wakeOnForces(Scalar dt, Scalar thickness);
+    void wakeOnContacts(const std::vector<int>& candidates, Scalar thickness);
+    void wakeAll();
+    void applySleepStates();
+    void resetLambdas();
+    void solveDistanceBatches(Scalar dt, ConstraintResidual* residual);
+    void rebuildSpatialHash();
+    bool needsHashRebuild() const;
 
-    std::vector<Particle> m_particles; 
-    std::vector<std::unique_ptr<Constraint>> m_constraints;
-    std::unordered_set<uint64_t> m_adjacencies;
+    ParticleStore m_particles;
+    std::vector<int> m_externalToInternal;
+    std::vector<int> m_internalToExternal;
+    mutable std::vector<Particle> m_particleView;
+    std::vector<DistanceConstraint> m_distanceConstraints;
+    std::vector<BendingConstraint> m_bendingConstraints;
+    std::vector<PinConstraint> m_pinConstraints;
+    std::vector<ContactConstraint> m_contactConstraints;
+    std::vector<std::unique_ptr<Constraint>> m_customConstraints;
+    std::vector<AttachmentConstraint> m_attachmentConstraints;
+    bool m_longRangeAttachments;
+    bool m_attachmentsDirty;
+
+    // Constraints whose particles all sleep, held out of the solve until their island wakes.
+    std::vector<DistanceConstraint> m_sleepingDistanceConstraints;
+    std::vector<BendingConstraint> m_sleepingBendingConstraints;
+    std::vector<PinConstraint> m_sleepingPinConstraints;
+    std::vector<ContactConstraint> m_sleepingContactConstraints;
+    std::vector<std::unique_ptr<Constraint>> m_sleepingCustomConstraints;
+    mutable std::vector<DistanceConstraint> m_distanceView;  ///< Active and sleeping, for the getters.
+    mutable std::vector<BendingConstraint> m_bendingView;
+    mutable std::vector<PinConstraint> m_pinView;
+    std::vector<int> m_particleIslands;     ///< Island of every particle.
+    std::vector<int> m_islandOffsets;       ///< Per-island CSR offsets into m_islandParticles.
+    std::vector<int> m_islandParticles;
+    std::vector<char> m_islandAsleep;
+    std::vector<char> m_islandWaking;       ///< Set by the wake checks, applied by applySleepStates().
+    std::vector<int> m_islandRestFrames;
+    std::vector<int> m_activeParticles;     ///< Particles of awake islands, in store order.
+    std::vector<int> m_contactParticles;    ///< Active particles plus islands pushed by a collider this frame.
+    int m_sleepingIslandCount;
+    bool m_sleeping;
+    bool m_islandsDirty;
+    Scalar m_sleepThreshold;
+    int m_sleepFrames;
+    Vec3 m_sleepUniformForce;               ///< Uniform force the sleeping islands came to rest under.
+
+    ConstraintBatches m_distanceBatches;
+    ConstraintBatches m_bendingBatches;
+    ConstraintBatches m_pinBatches;
+    ConstraintBatches m_contactBatches;
+    ConstraintBatches m_customBatches;
+    bool m_coloringDirty;
+    ParticleAdjacency m_adjacency;
+    bool m_adjacencyDirty;
+    int m_exclusionRings;
     
+    /** @brief Candidate self-collision pair, @c idA < @c idB. */
+    struct SelfCollisionPair {
+        int idA;
+        int idB;
+    };
+
+    /** @brief Self-collision pair found by the parallel pass, with its unweighted correction. */
+    struct SelfContact {
+        int idA;
+        int idB;
+        Vec3 correction;
+    };
+
+    /**
+     * @brief Vertex-triangle or edge-edge contact found by the BVH backend.
+     *
+     * The constraint acts on the distance |sum(weights[k] * x[ids[k]])|; vertex-triangle
+     * contacts use {1, -u, -v, -w} and edge-edge contacts {1-s, s, -(1-t), -t}.
+     */
+    struct TriangleContact {
+        int ids[4];
+        Scalar weights[4];
+        Vec3 correction;
+    };
+
+    /** @brief Impact found by continuous collision, as a stencil like TriangleContact with its separating normal. */
+    struct ContinuousImpact {
+        int ids[4];
+        Scalar weights[4];
+        Vec3 normal;
+    };
+
     SpatialHash m_spatialHash;
     std::vector<int> m_neighborsBuffer;
+    HashRebuildPolicy m_hashRebuildPolicy;
+    int m_hashRebuildInterval;
+    Scalar m_hashRebuildFraction;
+    bool m_hashDirty;
+    int m_hashBuildCount;
+    int m_substepsSinceHashBuild;
+    Scalar m_hashDisplacement;      ///< Upper bound of the motion of completed substeps since the last build.
+    Scalar m_predictDisplacement;   ///< Largest predicted motion of the current substep.
+    std::vector<std::vector<int>> m_threadNeighbors;
+    std::vector<std::vector<SelfContact>> m_threadContacts;
+    std::vector<SelfContact> m_selfContacts;
+    std::vector<int> m_selfContactOffsets;  ///< Per-particle CSR offsets into m_selfContactRefs.
+    std::vector<int> m_selfContactRefs;     ///< Contact index * stencil size plus the particle's slot in the contact.
+    SelfCollisionBackend m_selfCollisionBackend;
+    std::vector<std::vector<SelfCollisionPair>> m_threadPairs;
+    std::vector<SelfCollisionPair> m_verletPairs;
+    std::vector<Vec3> m_verletPositions;    ///< Positions when the pair list was built.
+    Scalar m_verletSkin;
+    Scalar m_verletThickness;
+    bool m_verletDirty;
+    int m_verletBuildCount;
+    TriangleBVH m_triangleBVH;
+    std::vector<SelfCollisionPair> m_meshEdges;     ///< Unique triangle edges.
+    std::vector<int> m_triangleEdges;               ///< Three entries per triangle indexing m_meshEdges.
+    std::vector<int> m_edgeOwners;                  ///< Lowest triangle using each edge, so queries report every edge once.
+    bool m_triangleTopologyDirty;
+    std::vector<std::vector<TriangleContact>> m_threadTriangleContacts;
+    std::vector<TriangleContact> m_triangleContacts;
+    bool m_continuousCollision;
+    int m_impactCount;
+    std::vector<Vec3> m_substepStart;   ///< Positions at the start of the substep, the origin of every trajectory.
+    std::vector<SelfCollisionPair> m_impactVertexPairs; ///< Cached (vertex, triangle) candidates, padded by the Verlet skin.
+    std::vector<SelfCollisionPair> m_impactEdgePairs;   ///< Cached (edge, edge) candidates, padded by the Verlet skin.
+    std::vector<Vec3> m_impactPositions;    ///< Positions when the candidate lists were built.
+    Scalar m_impactTolerance;
+    bool m_impactCandidatesDirty;
+    std::vector<std::vector<ContinuousImpact>> m_threadImpacts;
+    std::vector<ContinuousImpact> m_impacts;
+    SpatialHash m_colliderHash;             ///< Coarse particle bins for the collider broad phase.
+    std::vector<Vec3> m_colliderBounds;     ///< Lower and upper corner per collider.
+    std::vector<char> m_colliderBounded;
+    std::vector<int> m_colliderCandidates;
+    bool m_colliderBroadPhase;
 
     int m_substeps;
     int m_iterations;
-    double m_collisionCompliance;
+    Scalar m_collisionCompliance;
+    Scalar m_damping;
+    Vec3 m_uniformForce;    ///< Sum of the world's uniform forces, applied during prediction.
+    IterationAcceleration m_acceleration;
+    Scalar m_overRelaxation;
+    Scalar m_spectralRadius;
+    std::vector<Vec3> m_iterateStart;       ///< Positions before the current iteration.
+    std::vector<Vec3> m_iteratePrevious;    ///< Positions before the previous iteration, for Chebyshev.
+    Scalar m_residualTolerance;
+    int m_minIterations;
+    bool m_adaptiveSubsteps;
+    int m_minSubsteps;
+    int m_maxSubsteps;
+    Scalar m_substepMotionFraction;
+    Scalar m_lastSubstepDt;
+    std::vector<Vec3> m_collisionStart;     ///< Positions before the collision passes, for the penetration estimate.
+    FrameStats m_frameStats;
+    ConstraintSolveMode m_constraintMode;
+    SelfCollisionMode m_selfCollisionMode;
+    SimdLevel m_simdLevel;
 };
 
 } 
\ No newline at end of file
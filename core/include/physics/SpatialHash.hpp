@@ -18,19 +18,50 @@
 
 #include <vector>
 #include <Eigen/Dense>
+#include "math/Types.hpp"
 
 namespace ClothSDK {
 
-class Particle;
+class ParticleStore;
 
 class SpatialHash {
 public:
-    SpatialHash(int tableSize, double cellSize);
-    void build(const std::vector<Particle>& particles);
-    void query(const std::vector<Particle>& particles, const Eigen::Vector3d& pos, double radius, std::vector<int>& outNeighbors) const ;
+    /** @brief Below this many particles build() runs on a single thread. */
+    static constexpr int ParallelThreshold = 4096;
 
-    void setCellSize(double h) { m_cellSize = h; }
-    double getCellSize() const { return m_cellSize; }
+    SpatialHash(int tableSize, Scalar cellSize);
+
+    /**
+     * @brief Bins every particle into its hash cell with a parallel counting sort.
+     *
+     * Each thread hashes a contiguous range of particles into its own histogram, the
+     * histograms are turned into cell offsets with a blocked prefix scan, and each thread
+     * then scatters its range. Particles within a cell stay in index order for any thread
+     * count. All buffers are kept between calls, so rebuilding every frame or substep
+     * does not allocate once the particle count is stable.
+     *
+     * @param particles Particle store to index.
+     */
+    void build(const ParticleStore& particles);
+    void query(const ParticleStore& particles, const Vec3& pos, Scalar radius, std::vector<int>& outNeighbors) const ;
+
+    /**
+     * @brief Collects the particles whose current position lies inside a box.
+     *
+     * Cells one ring beyond the box are visited too, so particles that moved less than
+     * a cell since build() are still found. Results are sorted and unique even when
+     * several cells share a bucket. Boxes spanning more cells than there are buckets or
+     * particles fall back to a linear scan.
+     *
+     * @param particles Particle store passed to build().
+     * @param lower Minimum corner of the box.
+     * @param upper Maximum corner of the box.
+     * @param outParticles Cleared, then filled with particle indices in increasing order.
+     */
+    void queryBox(const ParticleStore& particles, const Vec3& lower, const Vec3& upper, std::vector<int>& outParticles) const;
+
+    void setCellSize(Scalar h) { m_cellSize = h; }
+    Scalar getCellSize() const { return m_cellSize; }
 private:
     inline int hashCoords(int x, int y, int z) const {
     unsigned int h = (static_cast<unsigned int>(x) * 73856093) ^ 
@@ -39,17 +70,19 @@ private:
     return static_cast<int>(h % m_tableSize);
 }
 
-    inline void posToGrid(const Eigen::Vector3d& pos, int& gx, int& gy, int& gz) const {
+    inline void posToGrid(const Vec3& pos, int& gx, int& gy, int& gz) const {
         gx = static_cast<int>(std::floor(pos.x() / m_cellSize));
         gy = static_cast<int>(std::floor(pos.y() / m_cellSize));
         gz = static_cast<int>(std::floor(pos.z() / m_cellSize));
     }
 
     int m_tableSize;
-    double m_cellSize;
+    Scalar m_cellSize;
     std::vector<int> m_cellStart;
     std::vector<int> m_particleIndices;
     std::vector<int> m_particleHashes;
+    std::vector<int> m_threadCounts;    ///< Per-thread histograms, later reused as scatter cursors.
+    std::vector<int> m_blockSums;       ///< Per-thread partial sums of the cell scan.
 };
 
 }
\ No newline at end of file
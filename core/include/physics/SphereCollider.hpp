@@ -29,6 +29,10 @@ namespace ClothSDK {
  * particles along the radial vector originating from the sphere's center. 
  * It provides a dynamic collision normal that varies based on the particle's 
  * relative position.
+ *
+ * The sphere can be animated by giving it a target center for the end of the next
+ * frame; the solver then slides it there over the substeps and friction acts on the
+ * particle's motion relative to the moving surface.
  */
 class SphereCollider : public Collider {
 public:
@@ -39,7 +43,7 @@ public:
      * @param radius The radius of the sphere in world units.
      * @param friction The friction coefficient.
      */
-    SphereCollider(const Eigen::Vector3d& center, double radius, double friction);
+    SphereCollider(const Vec3& center, Scalar radius, Scalar friction);
 
     /**
      * @brief Resolves collisions between the sphere and a buffer of particles.
@@ -50,14 +54,41 @@ public:
      * 3. Calculate the local collision normal as the normalized radial vector.
      * 4. Apply tangential friction to the particle's implicit velocity.
      *
-     * @param particles Reference to the global particle buffer.
+     * @param particles Reference to the solver's particle store.
      * @param dt Current substep time delta.
      */
-    void resolve(std::vector<Particle>& particles, double dt, double thickness);
+    void resolve(ParticleStore& particles, Scalar dt, Scalar thickness) override;
+    void resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar dt, Scalar thickness) override;
+    bool getBounds(Vec3& outLower, Vec3& outUpper) const override;
+    void setFrameTime(Scalar alpha) override;
+    void endFrame() override;
+
+    /**
+     * @brief Moves the sphere immediately, without any surface velocity.
+     *
+     * @param center New world-space center; also replaces any pending target.
+     */
+    void setCenter(const Vec3& center);
+
+    /**
+     * @brief Sets where the sphere should be at the end of the next Solver::update().
+     *
+     * @param center World-space center reached at the end of the frame.
+     */
+    inline void setTargetCenter(const Vec3& center) { m_targetCenter = center; }
+
+    inline const Vec3& getCenter() const { return m_center; }
+    inline const Vec3& getTargetCenter() const { return m_targetCenter; }
+    inline Scalar getRadius() const { return m_radius; }
 
 private:
-    Eigen::Vector3d m_center;   ///< The center point of the sphere in 3D space.
-    double m_radius;            ///< Radius of the collision volume. 
+    void resolveParticle(Vec3& position, Vec3& oldPosition, Scalar collisionRadius) const;
+
+    Vec3 m_center;   ///< The center point of the sphere in 3D space.
+    Scalar m_radius;            ///< Radius of the collision volume. 
+    Vec3 m_frameCenter;         ///< Center at the start of the current frame.
+    Vec3 m_targetCenter;        ///< Center at the end of the current frame.
+    Vec3 m_previousCenter;      ///< Center at the start of the current substep.
 };
 
 }
\ No newline at end of file
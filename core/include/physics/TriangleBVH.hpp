@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "math/Types.hpp"
+#include <vector>
+
+namespace ClothSDK {
+
+/**
+ * @struct BVHNode
+ * @brief Axis-aligned box of a BVH node.
+ *
+ * Leaves own triangles [first, first + count) of the BVH's triangle order; inner
+ * nodes have @c count == 0 and two children.
+ */
+struct BVHNode {
+    Vec3 lower;
+    Vec3 upper;
+    int left;
+    int right;
+    int first;
+    int count;
+
+    inline bool isLeaf() const { return count > 0; }
+};
+
+/**
+ * @class TriangleBVH
+ * @brief Bounding volume hierarchy over a triangle mesh whose vertices move.
+ *
+ * The tree topology is built once from the triangle list with median splits and is
+ * then refitted bottom-up as the vertices move, which keeps queries valid without
+ * rebuilding the tree on every substep. Nodes are grouped by depth so each level of
+ * the refit runs in parallel.
+ */
+class TriangleBVH {
+public:
+    /** @brief Maximum number of triangles stored in a leaf. */
+    static constexpr int LeafSize = 4;
+
+    TriangleBVH() = default;
+
+    /**
+     * @brief Builds the tree topology and fits it to the given positions.
+     *
+     * @param triangles Triangles as particle indices.
+     * @param positions Particle positions.
+     */
+    void build(const std::vector<Triangle>& triangles, const std::vector<Vec3>& positions);
+
+    /**
+     * @brief Recomputes every box from the current positions, leaves first.
+     *
+     * @param positions Particle positions, indexed like the triangles passed to build().
+     */
+    void refit(const std::vector<Vec3>& positions);
+
+    /**
+     * @brief Fits every box around the vertex motion from @p start to @p end.
+     *
+     * Used by continuous collision, whose queries must cover whole trajectories.
+     *
+     * @param start Particle positions at the start of the motion.
+     * @param end Particle positions at the end of the motion.
+     */
+    void refit(const std::vector<Vec3>& start, const std::vector<Vec3>& end);
+
+    /**
+     * @brief Collects the triangles of every leaf whose box overlaps a query box.
+     *
+     * Results are at leaf granularity, so they can include a few triangles whose own
+     * box misses the query; the narrow phase is expected to reject them.
+     *
+     * @param lower Minimum corner of the query box.
+     * @param upper Maximum corner of the query box.
+     * @param outTriangles Cleared, then filled with indices into the triangle list.
+     */
+    void query(const Vec3& lower, const Vec3& upper, std::vector<int>& outTriangles) const;
+
+    /**
+     * @brief Removes every node and triangle.
+     */
+    void clear();
+
+    inline bool empty() const { return m_nodes.empty(); }
+    inline const std::vector<BVHNode>& getNodes() const { return m_nodes; }
+    inline const std::vector<Triangle>& getTriangles() const { return m_triangles; }
+    inline int getTriangleCount() const { return static_cast<int>(m_triangles.size()); }
+
+private:
+    int buildNode(int first, int count, int depth, const std::vector<Vec3>& centroids);
+    void refitLevels(const std::vector<Vec3>& positions, const std::vector<Vec3>* endPositions);
+    void fitNode(BVHNode& node, const std::vector<Vec3>& positions, const std::vector<Vec3>* endPositions) const;
+
+    std::vector<Triangle> m_triangles;
+    std::vector<BVHNode> m_nodes;
+    std::vector<int> m_order;           ///< Triangle indices in leaf order.
+    std::vector<int> m_nodeDepths;
+    std::vector<int> m_levelOffsets;    ///< Level @c d covers m_levelNodes[m_levelOffsets[d], m_levelOffsets[d+1]).
+    std::vector<int> m_levelNodes;
+};
+
+}
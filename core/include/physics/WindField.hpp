@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Evan M.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "math/Types.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ClothSDK {
+
+/**
+ * @class WindField
+ * @brief Tiled 3D grid of wind velocities, sampled with trilinear interpolation.
+ *
+ * The grid repeats in every direction, so it covers any scene however small it is.
+ * Instead of being simulated, the pattern is carried along by a constant drift
+ * velocity: sampling at time @c t reads the grid at @c point - drift * t, which moves
+ * the gusts downwind at no cost per step.
+ *
+ * Grids come from turbulence(), which builds divergence-free curl noise, or from a
+ * binary file written by save().
+ */
+class WindField {
+public:
+    /**
+     * @brief Wraps existing samples.
+     *
+     * Invalid dimensions or cell size are logged and leave the field empty, which samples as zero.
+     *
+     * @param origin World position of sample (0, 0, 0).
+     * @param cellSize Grid spacing in world units.
+     * @param nx Samples along x; the grid repeats every @p nx cells.
+     * @param ny Samples along y.
+     * @param nz Samples along z.
+     * @param velocities x-fastest samples, nx * ny * nz of them.
+     */
+    WindField(const Vec3& origin, Scalar cellSize, int nx, int ny, int nz, const std::vector<Vec3>& velocities);
+
+    /**
+     * @brief Generates a cubic tile of curl noise.
+     *
+     * A random vector potential is smoothed and its curl taken, which yields swirling,
+     * divergence-free gusts about four cells across. The result is scaled to the
+     * requested root mean square speed.
+     *
+     * @param resolution Samples per axis, at least 4.
+     * @param cellSize Grid spacing in world units.
+     * @param strength Root mean square speed of the gusts.
+     * @param seed Random seed; equal seeds give equal fields.
+     */
+    static std::unique_ptr<WindField> turbulence(int resolution, Scalar cellSize, Scalar strength, unsigned int seed);
+
+    /**
+     * @brief Loads a grid written by save().
+     *
+     * @return The field, or nullptr when the file is missing or not a wind grid.
+     */
+    static std::unique_ptr<WindField> load(const std::string& path);
+
+    /**
+     * @brief Writes the grid to a binary file.
+     *
+     * @return True on success.
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Wind velocity at a world-space point.
+     *
+     * @param point Query point.
+     * @param time Elapsed time, for the drift of the pattern.
+     */
+    Vec3 sample(const Vec3& point, Scalar time) const;
+
+    /**
+     * @brief Sets the velocity at which the gust pattern travels.
+     *
+     * Usually the mean wind, so gusts move with the air that carries them.
+     */
+    inline void setDrift(const Vec3& drift) { m_drift = drift; }
+
+    inline const Vec3& getDrift() const { return m_drift; }
+    inline const Vec3& getOrigin() const { return m_origin; }
+    inline Scalar getCellSize() const { return m_cellSize; }
+    inline int getResolution(int axis) const { return m_resolution[axis]; }
+
+private:
+    WindField() = default;
+
+    inline int index(int x, int y, int z) const { return (z * m_resolution[1] + y) * m_resolution[0] + x; }
+
+    Vec3 m_origin = Vec3::Zero();
+    Vec3 m_drift = Vec3::Zero();
+    Scalar m_cellSize = 1.0;
+    int m_resolution[3] = { 0, 0, 0 };
+    std::vector<float> m_samples;   ///< Three components per sample, x-fastest.
+};
+
+}
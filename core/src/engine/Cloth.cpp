@@ -21,6 +21,21 @@ namespace ClothSDK {
         m_visualEdges.push_back(idB); 
     }
 
+    void Cloth::remapParticles(const std::vector<int>& newIndex) {
+        for (int& id : m_particleIndices) id = newIndex[id];
+        for (Triangle& tri : m_triangles) {
+            tri.a = newIndex[tri.a];
+            tri.b = newIndex[tri.b];
+            tri.c = newIndex[tri.c];
+        }
+        for (unsigned int& id : m_visualEdges) id = static_cast<unsigned int>(newIndex[id]);
+        for (AeroFace& face : m_faces) {
+            face.a = newIndex[face.a];
+            face.b = newIndex[face.b];
+            face.c = newIndex[face.c];
+        }
+    }
+
     void Cloth::clear() {
         m_particleIndices.clear();
         m_triangles.clear();
@@ -32,7 +32,7 @@ void ClothMesh::initGrid(int rows, int cols, double spacing, Cloth& outCloth, So
     
     for(int r = 0; r < rows; r++) {
         for(int c = 0; c < cols; c++) {
-            Eigen::Vector3d pos(c * spacing, r * spacing, 0.0);
+            Vec3 pos(c * spacing, r * spacing, 0.0);
             int id = solver.addParticle(Particle(pos));
             gridIndices.push_back(id);
             outCloth.addParticleId(id);
@@ -77,7 +77,7 @@ void ClothMesh::initGrid(int rows, int cols, double spacing, Cloth& outCloth, So
     computePhysicalAttributes(outCloth, solver);
 }
 
-void ClothMesh::buildFromMesh(const std::vector<Eigen::Vector3d>& positions, const std::vector<int>& indices, Cloth& outCloth, Solver& solver) {
+void ClothMesh::buildFromMesh(const std::vector<Vec3>& positions, const std::vector<int>& indices, Cloth& outCloth, Solver& solver) {
     std::map<Edge, std::vector<int>> edgeToTriangles;
     std::vector<int> localToGlobal; 
     localToGlobal.reserve(positions.size());
@@ -143,18 +143,18 @@ int ClothMesh::getOppositeVertex(const Triangle& tri, int v1, int v2) const{
 }
 
 double ClothMesh::calculateInitialAngle(int id1, int id2, int id3, int id4, const Solver& solver) const {
-    const auto& particles = solver.getParticles();
+    const auto& particles = solver.getParticleStore();
     
-    const Eigen::Vector3d& p1 = particles[id1].getPosition();
-    const Eigen::Vector3d& p2 = particles[id2].getPosition(); 
-    const Eigen::Vector3d& p3 = particles[id3].getPosition(); 
-    const Eigen::Vector3d& p4 = particles[id4].getPosition(); 
+    const Vec3& p1 = particles.getPosition(id1);
+    const Vec3& p2 = particles.getPosition(id2); 
+    const Vec3& p3 = particles.getPosition(id3); 
+    const Vec3& p4 = particles.getPosition(id4); 
 
-    Eigen::Vector3d e = p2 - p1;
+    Vec3 e = p2 - p1;
     if (e.isZero(1e-6)) return 0.0; 
 
-    Eigen::Vector3d n1 = e.cross(p3 - p1);
-    Eigen::Vector3d n2 = (p4 - p1).cross(e); 
+    Vec3 n1 = e.cross(p3 - p1);
+    Vec3 n2 = (p4 - p1).cross(e); 
 
     double len1 = n1.norm();
     double len2 = n2.norm();
@@ -167,18 +167,18 @@ double ClothMesh::calculateInitialAngle(int id1, int id2, int id3, int id4, cons
 }
 
 void ClothMesh::computePhysicalAttributes(Cloth& cloth, Solver& solver) const {
-    const auto& particles = solver.getParticles();
+    const auto& particles = solver.getParticleStore();
     const auto& triangles = cloth.getTriangles();
     const auto& indices = cloth.getParticleIndices();
     double density = cloth.getMaterial()->density;
 
     for(const auto& triangle : triangles) {
-        const Particle& pA = particles[triangle.a];
-        const Particle& pB = particles[triangle.b];
-        const Particle& pC = particles[triangle.c];
+        const Vec3& pA = particles.getPosition(triangle.a);
+        const Vec3& pB = particles.getPosition(triangle.b);
+        const Vec3& pC = particles.getPosition(triangle.c);
 
-        Eigen::Vector3d v1 = pB.getPosition() - pA.getPosition();
-        Eigen::Vector3d v2 = pC.getPosition() - pA.getPosition();
+        Vec3 v1 = pB - pA;
+        Vec3 v2 = pC - pA;
 
         double area = 0.5 * v1.cross(v2).norm();
         double massPerVertex = (area * density) / 3.0;
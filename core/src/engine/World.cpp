@@ -27,11 +27,11 @@ void World::clear() {
     m_forces.clear();
 }
 
-void World::addPlaneCollider(const Eigen::Vector3d& origin, const Eigen::Vector3d& normal, double friction) {
+void World::addPlaneCollider(const Vec3& origin, const Vec3& normal, Scalar friction) {
     m_colliders.push_back(std::make_unique<PlaneCollider>(origin, normal, friction));
 }
 
-void World::addSphereCollider(const Eigen::Vector3d& center, double radius, double friction) {
+void World::addSphereCollider(const Vec3& center, Scalar radius, Scalar friction) {
     m_colliders.push_back(std::make_unique<SphereCollider>(center, radius, friction));
 }
 
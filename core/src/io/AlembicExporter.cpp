@@ -24,7 +24,7 @@ AlembicExporter::AlembicExporter() : m_impl(std::make_unique<Impl>()) {}
 AlembicExporter::~AlembicExporter() = default;
 
 bool AlembicExporter::open(const std::string& path, 
-                            const std::vector<Eigen::Vector3d>& positions, 
+                            const std::vector<Vec3>& positions, 
                             const std::vector<int>& indices) {
     try {
         m_impl->archive = std::make_unique<OArchive>(Alembic::AbcCoreOgawa::WriteArchive(), path);
@@ -61,7 +61,7 @@ bool AlembicExporter::open(const std::string& path,
     }
 }
 
-void AlembicExporter::writeFrame(const std::vector<Eigen::Vector3d>& positions, double time) {
+void AlembicExporter::writeFrame(const std::vector<Vec3>& positions, double time) {
     if (!m_impl->mesh) return;
 
     std::vector<Imath::V3f> alembicPos;
@@ -50,7 +50,7 @@ bool ConfigLoader::load(const std::string& filepath, Solver& solver, World& worl
         if (aero.contains("wind_velocity")) {
             world.setWind(jsonToVector(aero["wind_velocity"]));
         } else {
-            world.setWind(Eigen::Vector3d(5.0, 0.0, 0.0));
+            world.setWind(Vec3(5.0, 0.0, 0.0));
         }
         world.setAirDensity(aero.value("air_density", 0.1));
     }
@@ -88,14 +88,14 @@ bool ConfigLoader::save(const std::string& filepath, const Solver& solver, const
     return true;
 }
 
-Eigen::Vector3d ConfigLoader::jsonToVector(const nlohmann::json& json) {
+Vec3 ConfigLoader::jsonToVector(const nlohmann::json& json) {
     if (!json.is_array() || json.size() != 3)
-        return Eigen::Vector3d::Zero();
+        return Vec3::Zero();
 
-    return Eigen::Vector3d(json[0].get<double>(), json[1].get<double>(), json[2].get<double>());
+    return Vec3(json[0].get<double>(), json[1].get<double>(), json[2].get<double>());
 }
 
-nlohmann::json ConfigLoader::vectorToJson(const Eigen::Vector3d& vector) {
+nlohmann::json ConfigLoader::vectorToJson(const Vec3& vector) {
     return nlohmann::json{ vector.x(), vector.y(), vector.z() };
 }
 
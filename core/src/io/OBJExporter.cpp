@@ -14,11 +14,11 @@ void OBJExporter::exportOBJ(const std::string &filename, const Cloth& cloth, con
         return;
     }
 
-    const std::vector<Particle>& allParticles = solver.getParticles();
+    const ParticleStore& allParticles = solver.getParticleStore();
     
     const std::vector<int>& pIndices = cloth.getParticleIndices();
     for (int id : pIndices) {
-        const Eigen::Vector3d& pos = allParticles[id].getPosition();
+        const Vec3& pos = allParticles.getPosition(id);
         file << "v " << pos.x() << " " << pos.y() << " " << pos.z() << "\n";
     }
 
@@ -9,7 +9,7 @@
 
 namespace ClothSDK {
 
-bool OBJLoader::load(const std::string& path, std::vector<Eigen::Vector3d>& outPos, std::vector<int>& outIndices) {
+bool OBJLoader::load(const std::string& path, std::vector<Vec3>& outPos, std::vector<int>& outIndices) {
     tinyobj::attrib_t attrib;
     std::vector<tinyobj::shape_t> shapes;
     std::vector<tinyobj::material_t> materials;
@@ -9,66 +9,124 @@ namespace ClothSDK {
 
 AerodynamicForce::AerodynamicForce(
     const std::vector<AeroFace>& faces,
-    const Eigen::Vector3d& wind,
-    double airDensity
+    const Vec3& wind,
+    Scalar airDensity
 )
     : m_faces(faces),
         m_wind(wind),
         m_airDensity(airDensity) {}
 
-void AerodynamicForce::apply(std::vector<Particle>& particles, double dt) {
+void AerodynamicForce::buildVertexFaces(int particleCount) {
+    const int faceCount = static_cast<int>(m_faces.size());
+
+    m_vertexOffsets.assign(particleCount + 1, 0);
+    for (const auto& face : m_faces) {
+        m_vertexOffsets[face.a + 1]++;
+        m_vertexOffsets[face.b + 1]++;
+        m_vertexOffsets[face.c + 1]++;
+    }
+    for (int i = 0; i < particleCount; ++i)
+        m_vertexOffsets[i + 1] += m_vertexOffsets[i];
+
+    // Faces are appended in increasing order, so every row is sorted and the gather
+    // sums in the same order on every run.
+    m_vertexFaces.resize(3 * faceCount);
+    std::vector<int> cursor(m_vertexOffsets.begin(), m_vertexOffsets.end() - 1);
+    for (int f = 0; f < faceCount; ++f) {
+        m_vertexFaces[cursor[m_faces[f].a]++] = f;
+        m_vertexFaces[cursor[m_faces[f].b]++] = f;
+        m_vertexFaces[cursor[m_faces[f].c]++] = f;
+    }
+
+    m_faceForces.resize(faceCount);
+    m_vertexFacesDirty = false;
+}
+
+void AerodynamicForce::apply(ParticleStore& particles, Scalar dt) {
     if (dt < 1e-6)
         return;
 
     m_time += dt;
 
-    double gust = std::sin(m_time * 5.0) * 0.5 + 0.5;
-    Eigen::Vector3d currentWind = m_wind * (1.0 + gust);
+    Scalar gust = std::sin(m_time * 5.0) * 0.5 + 0.5;
+    Vec3 currentWind = m_windField ? m_wind : Vec3(m_wind * (1.0 + gust));
+    const WindField* field = m_windField.get();
+
+    const int particleCount = particles.size();
+    const int faceCount = static_cast<int>(m_faces.size());
+    if (m_vertexFacesDirty || static_cast<int>(m_vertexOffsets.size()) != particleCount + 1)
+        buildVertexFaces(particleCount);
 
-    #pragma omp parallel for
-    for (int i = 0; i < (int)m_faces.size(); i++) {
-        const auto& face = m_faces[i];
+    m_velocities.resize(particleCount);
 
-        Particle& pA = particles[face.a];
-        Particle& pB = particles[face.b];
-        Particle& pC = particles[face.c];
+    #pragma omp parallel
+    {
+        #pragma omp for schedule(static)
+        for (int i = 0; i < particleCount; i++)
+            m_velocities[i] = particles.getVelocity(i, dt);
 
-        Eigen::Vector3d vFace =
-            (pA.getVelocity(dt) +
-                pB.getVelocity(dt) +
-                pC.getVelocity(dt)) / 3.0;
+        #pragma omp for schedule(static)
+        for (int i = 0; i < faceCount; i++) {
+            const auto& face = m_faces[i];
+            m_faceForces[i] = Vec3::Zero();
 
-        Eigen::Vector3d vRel = vFace - currentWind;
-        double vMag = vRel.norm();
+            Vec3 vFace = (m_velocities[face.a] + m_velocities[face.b] + m_velocities[face.c]) / 3.0;
 
-        if (vMag < 1e-4)
-            continue;
+            const Vec3& pa = particles.getPosition(face.a);
+            const Vec3& pb = particles.getPosition(face.b);
+            const Vec3& pc = particles.getPosition(face.c);
 
-        Eigen::Vector3d edge1 = pB.getPosition() - pA.getPosition();
-        Eigen::Vector3d edge2 = pC.getPosition() - pA.getPosition();
+            Vec3 wind = currentWind;
+            if (field)
+                wind += field->sample((pa + pb + pc) / 3.0, m_time);
 
-        Eigen::Vector3d n = edge1.cross(edge2);
-        double area = 0.5 * n.norm();
+            Vec3 vRel = vFace - wind;
+            Scalar vMag = vRel.norm();
 
-        if (area < 1e-6)
-            continue;
+            if (vMag < 1e-4)
+                continue;
 
-        Eigen::Vector3d normal = n.normalized();
+            Vec3 edge1 = pb - pa;
+            Vec3 edge2 = pc - pa;
 
-        double pressure = vRel.dot(normal) / vMag;
+            Vec3 n = edge1.cross(edge2);
+            Scalar area = 0.5 * n.norm();
 
-        Eigen::Vector3d force =
-            -0.5 * m_airDensity * vMag * vMag * area * pressure * normal;
+            if (area < 1e-6)
+                continue;
 
-        Eigen::Vector3d f = force / 3.0;
+            Vec3 normal = n.normalized();
 
-        #pragma omp critical
-        {
-            pA.addForce(f);
-            pB.addForce(f);
-            pC.addForce(f);
+            Scalar pressure = vRel.dot(normal) / vMag;
+
+            Vec3 force =
+                -0.5 * m_airDensity * vMag * vMag * area * pressure * normal;
+
+            m_faceForces[i] = force / 3.0;
+        }
+
+        // Each vertex only reads face slots and writes its own accumulator.
+        #pragma omp for schedule(static)
+        for (int i = 0; i < particleCount; i++) {
+            const int begin = m_vertexOffsets[i];
+            const int end = m_vertexOffsets[i + 1];
+            if (begin == end) continue;
+
+            Vec3 f = Vec3::Zero();
+            for (int k = begin; k < end; ++k)
+                f += m_faceForces[m_vertexFaces[k]];
+            particles.addForce(i, f);
         }
     }
 }
 
+void AerodynamicForce::remapParticles(const std::vector<int>& newIndex) {
+    for (auto& face : m_faces) {
+        face.a = newIndex[face.a];
+        face.b = newIndex[face.b];
+        face.c = newIndex[face.c];
+    }
+    m_vertexFacesDirty = true;
+}
+
 } 
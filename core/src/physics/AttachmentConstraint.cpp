@@ -0,0 +1,22 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/AttachmentConstraint.hpp"
+#include <cmath>
+
+namespace ClothSDK {
+
+AttachmentConstraint::AttachmentConstraint(int particleId, int anchorId, Scalar maxDistance)
+: particleId(particleId), anchorId(anchorId), maxDistance(maxDistance) {}
+
+void AttachmentConstraint::solve(ParticleStore& particles) const {
+    const Vec3& anchor = particles.getPosition(anchorId);
+    const Vec3 dir = particles.getPosition(particleId) - anchor;
+    const Scalar distSq = dir.squaredNorm();
+
+    if (distSq <= maxDistance * maxDistance) return;
+
+    particles.setPosition(particleId, anchor + dir * (maxDistance / std::sqrt(distSq)));
+}
+
+}
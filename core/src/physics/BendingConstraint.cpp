@@ -9,71 +9,65 @@ namespace ClothSDK {
 
 BendingConstraint::BendingConstraint(
     int idA, int idB, int idC, int idD,
-    double restAngle, double compliance)
-: m_idA(idA), m_idB(idB), m_idC(idC), m_idD(idD),
-  m_restAngle(restAngle)
-{
-    m_compliance = compliance;
-}
+    Scalar restAngle, Scalar compliance)
+: idA(idA), idB(idB), idC(idC), idD(idD),
+  restAngle(restAngle), compliance(compliance), lambda(0.0) {}
 
-void BendingConstraint::solve(std::vector<Particle>& particles, double dt) {
+void BendingConstraint::solve(ParticleStore& particles, Scalar dt, ConstraintResidual* residual) {
     if (dt < 1e-6) return;
 
-    Particle& pA = particles[m_idA];
-    Particle& pB = particles[m_idB];
-    Particle& pC = particles[m_idC];
-    Particle& pD = particles[m_idD];
-
-    const Eigen::Vector3d& xA = pA.getPosition();
-    const Eigen::Vector3d& xB = pB.getPosition();
-    const Eigen::Vector3d& xC = pC.getPosition();
-    const Eigen::Vector3d& xD = pD.getPosition();
+    const Vec3 xA = particles.getPosition(idA);
+    const Vec3 xB = particles.getPosition(idB);
+    const Vec3 xC = particles.getPosition(idC);
+    const Vec3 xD = particles.getPosition(idD);
 
-    Eigen::Vector3d e = xB - xA;
-    double len = e.norm();
+    Vec3 e = xB - xA;
+    Scalar len = e.norm();
     if (len < 1e-6) return;
 
-    Eigen::Vector3d n1 = e.cross(xC - xA);
-    Eigen::Vector3d n2 = e.cross(xD - xA);
+    Vec3 n1 = e.cross(xC - xA);
+    Vec3 n2 = e.cross(xD - xA);
 
-    double n1_sq = n1.squaredNorm();
-    double n2_sq = n2.squaredNorm();
+    Scalar n1_sq = n1.squaredNorm();
+    Scalar n2_sq = n2.squaredNorm();
     if (n1_sq < 1e-8 || n2_sq < 1e-8) return;
 
-    double invLenN = 1.0 / std::sqrt(n1_sq * n2_sq);
-    double cosTheta = n1.dot(n2) * invLenN;
+    Scalar invLenN = 1.0 / std::sqrt(n1_sq * n2_sq);
+    Scalar cosTheta = n1.dot(n2) * invLenN;
+
+    Vec3 cross_n = n1.cross(n2);
+    Scalar sinTheta = cross_n.dot(e) / (len * std::sqrt(n1_sq * n2_sq));
 
-    Eigen::Vector3d cross_n = n1.cross(n2);
-    double sinTheta = cross_n.dot(e) / (len * std::sqrt(n1_sq * n2_sq));
+    Scalar angle = std::atan2(sinTheta, cosTheta);
 
-    double angle = std::atan2(sinTheta, cosTheta);
+    Scalar C = angle - restAngle;
 
-    double C = angle - m_restAngle;
+    Scalar wA = particles.getInverseMass(idA);
+    Scalar wB = particles.getInverseMass(idB);
+    Scalar wC = particles.getInverseMass(idC);
+    Scalar wD = particles.getInverseMass(idD);
+    if (residual && wA + wB + wC + wD != 0.0)
+        residual->add(C);
 
     if (std::abs(C) < 1e-6)
         return;
 
-    Eigen::Vector3d gradC = (len / n1_sq) * n1;
-    Eigen::Vector3d gradD = -(len / n2_sq) * n2;
+    Vec3 gradC = (len / n1_sq) * n1;
+    Vec3 gradD = -(len / n2_sq) * n2;
 
-    double invLen2 = 1.0 / (len * len);
+    Scalar invLen2 = 1.0 / (len * len);
 
-    Eigen::Vector3d gradA =
+    Vec3 gradA =
         ((xC - xB).dot(e) * invLen2) * gradC +
         ((xD - xB).dot(e) * invLen2) * gradD;
 
-    Eigen::Vector3d gradB =
+    Vec3 gradB =
         ((xA - xC).dot(e) * invLen2) * gradC +
         ((xA - xD).dot(e) * invLen2) * gradD;
 
-    double wA = pA.getInverseMass();
-    double wB = pB.getInverseMass();
-    double wC = pC.getInverseMass();
-    double wD = pD.getInverseMass();
+    Scalar alpha = compliance / (dt * dt);
 
-    double alpha = m_compliance / (dt * dt);
-
-    double denom =
+    Scalar denom =
         wA * gradA.squaredNorm() +
         wB * gradB.squaredNorm() +
         wC * gradC.squaredNorm() +
@@ -82,13 +76,32 @@ void BendingConstraint::solve(std::vector<Particle>& particles, double dt) {
 
     if (denom < 1e-8) return;
 
-    double deltaLambda = -(C + alpha * m_lambda) / denom;
-    m_lambda += deltaLambda;
+    Scalar deltaLambda = -(C + alpha * lambda) / denom;
+    lambda += deltaLambda;
+
+    particles.setPosition(idA, xA + wA * deltaLambda * gradA);
+    particles.setPosition(idB, xB + wB * deltaLambda * gradB);
+    particles.setPosition(idC, xC + wC * deltaLambda * gradC);
+    particles.setPosition(idD, xD + wD * deltaLambda * gradD);
+}
+
+Scalar BendingConstraint::evaluate(const ParticleStore& particles) const {
+    const Vec3& xA = particles.getPosition(idA);
+    const Vec3 e = particles.getPosition(idB) - xA;
+    Scalar len = e.norm();
+    if (len < 1e-6) return 0.0;
+
+    Vec3 n1 = e.cross(particles.getPosition(idC) - xA);
+    Vec3 n2 = e.cross(particles.getPosition(idD) - xA);
+    Scalar n1_sq = n1.squaredNorm();
+    Scalar n2_sq = n2.squaredNorm();
+    if (n1_sq < 1e-8 || n2_sq < 1e-8) return 0.0;
+
+    Scalar lenN = std::sqrt(n1_sq * n2_sq);
+    Scalar cosTheta = n1.dot(n2) / lenN;
+    Scalar sinTheta = n1.cross(n2).dot(e) / (len * lenN);
 
-    pA.setPosition(xA + wA * deltaLambda * gradA);
-    pB.setPosition(xB + wB * deltaLambda * gradB);
-    pC.setPosition(xC + wC * deltaLambda * gradC);
-    pD.setPosition(xD + wD * deltaLambda * gradD);
+    return std::atan2(sinTheta, cosTheta) - restAngle;
 }
 
 }
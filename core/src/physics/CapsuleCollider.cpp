@@ -4,51 +4,99 @@
 #include <Eigen/Dense>
 
 #include "physics/CapsuleCollider.hpp"
-#include "physics/Particle.hpp"
+#include "physics/ParticleStore.hpp"
 
 namespace ClothSDK {
 
-CapsuleCollider::CapsuleCollider(double radius, const Eigen::Vector3d& start, const Eigen::Vector3d& end, double friction)
-    : m_radius(radius), m_start(start), m_end(end) {m_friction = friction; }
+CapsuleCollider::CapsuleCollider(Scalar radius, const Vec3& start, const Vec3& end, Scalar friction)
+    : m_radius(radius), m_start(start), m_end(end) {
+    m_friction = friction;
+    setPose(start, end);
+}
 
-void CapsuleCollider::resolve(std::vector<Particle>& particles, double dt, double thickness) {
-    double collisionRadius = m_radius + thickness;
-    double collisionRadiusSq = collisionRadius * collisionRadius; 
+void CapsuleCollider::resolveParticle(Vec3& position, Vec3& oldPosition, Scalar collisionRadius) const {
+    Vec3 segment = m_end - m_start;
+    Scalar segmentLenSq = segment.squaredNorm();
 
-    Eigen::Vector3d segment = m_end - m_start;
-    double segmentLenSq = segment.squaredNorm();
+    Vec3 pToA = position - m_start;
+    
+    Scalar t = 0.0;
+    
+    if (segmentLenSq > 1e-6) 
+        t = pToA.dot(segment) / segmentLenSq;
 
-    for (auto& particle : particles) {
-        Eigen::Vector3d pos = particle.getPosition();
-        Eigen::Vector3d pToA = pos - m_start;
-        
-        double t = 0.0;
+    if (t < 0.0) {
+        t = 0.0; 
+    } else if (t > 1.0) {
+        t = 1.0; 
+    }
+
+    Vec3 closestPoint = m_start + (segment * t);
+
+    Vec3 diff = position - closestPoint;
+    Scalar distSq = diff.squaredNorm();
+
+    if (distSq < collisionRadius * collisionRadius && distSq > 1e-9) {
+        Scalar dist = std::sqrt(distSq);
         
-        if (segmentLenSq > 1e-6) 
-            t = pToA.dot(segment) / segmentLenSq;
+        Vec3 normal = diff / dist;
 
-        if (t < 0.0) {
-            t = 0.0; 
-        } else if (t > 1.0) {
-            t = 1.0; 
-        }
+        position = closestPoint + (normal * collisionRadius);
 
-        Eigen::Vector3d closestPoint = m_start + (segment * t);
+        Vec3 surfaceDisplacement = (m_start - m_previousStart) * (1 - t) + (m_end - m_previousEnd) * t;
+        Vec3 velocity = position - oldPosition;
 
-        Eigen::Vector3d diff = pos - closestPoint;
-        double distSq = diff.squaredNorm();
+        oldPosition = position - frictionVelocity(velocity, normal, surfaceDisplacement);
+    }
+}
 
-        if (distSq < collisionRadiusSq && distSq > 1e-9) {
-            double dist = std::sqrt(distSq);
-            
-            Eigen::Vector3d normal = diff / dist;
+void CapsuleCollider::resolve(ParticleStore& particles, Scalar dt, Scalar thickness) {
+    Scalar collisionRadius = m_radius + thickness;
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const int count = particles.size();
 
-            Eigen::Vector3d targetPos = closestPoint + (normal * collisionRadius);
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < count; ++i)
+        resolveParticle(positions[i], oldPositions[i], collisionRadius);
+}
 
-            particle.setPosition(targetPos);
+void CapsuleCollider::resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar /*dt*/, Scalar thickness) {
+    Scalar collisionRadius = m_radius + thickness;
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const int count = static_cast<int>(candidates.size());
 
-        }
-    }
+    #pragma omp parallel for schedule(static)
+    for (int k = 0; k < count; ++k)
+        resolveParticle(positions[candidates[k]], oldPositions[candidates[k]], collisionRadius);
+}
+
+bool CapsuleCollider::getBounds(Vec3& outLower, Vec3& outUpper) const {
+    outLower = m_start.cwiseMin(m_end) - Vec3::Constant(m_radius);
+    outUpper = m_start.cwiseMax(m_end) + Vec3::Constant(m_radius);
+    return true;
+}
+
+void CapsuleCollider::setFrameTime(Scalar alpha) {
+    m_previousStart = m_start;
+    m_previousEnd = m_end;
+    m_start = m_frameStart + (m_targetStart - m_frameStart) * alpha;
+    m_end = m_frameEnd + (m_targetEnd - m_frameEnd) * alpha;
+}
+
+void CapsuleCollider::endFrame() {
+    setPose(m_targetStart, m_targetEnd);
+}
+
+void CapsuleCollider::setPose(const Vec3& start, const Vec3& end) {
+    m_start = m_frameStart = m_targetStart = m_previousStart = start;
+    m_end = m_frameEnd = m_targetEnd = m_previousEnd = end;
+}
+
+void CapsuleCollider::setTargetPose(const Vec3& start, const Vec3& end) {
+    m_targetStart = start;
+    m_targetEnd = end;
 }
 
 }
\ No newline at end of file
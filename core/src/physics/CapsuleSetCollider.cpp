@@ -0,0 +1,203 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/CapsuleSetCollider.hpp"
+#include "physics/ParticleStore.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace ClothSDK {
+
+CapsuleSetCollider::CapsuleSetCollider(Scalar friction)
+    : m_boneCount(0), m_maxRadius(0.0)
+{
+    m_friction = friction;
+}
+
+int CapsuleSetCollider::addCapsule(int bone, Scalar radius, const Vec3& start, const Vec3& end) {
+    m_bones.push_back(bone);
+    m_radii.push_back(radius);
+    m_localStarts.push_back(start);
+    m_localEnds.push_back(end);
+    m_boneCount = std::max(m_boneCount, bone + 1);
+    m_maxRadius = std::max(m_maxRadius, radius);
+
+    Vec3 worldStart = start;
+    Vec3 worldEnd = end;
+    if (bone < static_cast<int>(m_boneTransforms.size())) {
+        const Mat4& m = m_boneTransforms[bone];
+        worldStart = m.topLeftCorner<3, 3>() * start + m.topRightCorner<3, 1>();
+        worldEnd = m.topLeftCorner<3, 3>() * end + m.topRightCorner<3, 1>();
+    }
+
+    m_starts.push_back(worldStart);
+    m_ends.push_back(worldEnd);
+    m_previousStarts.push_back(worldStart);
+    m_previousEnds.push_back(worldEnd);
+    m_frameStarts.push_back(worldStart);
+    m_frameEnds.push_back(worldEnd);
+    m_targetStarts.push_back(worldStart);
+    m_targetEnds.push_back(worldEnd);
+
+    rebuildTree();
+    return getCapsuleCount() - 1;
+}
+
+void CapsuleSetCollider::placeCapsules(const std::vector<Mat4>& bones, std::vector<Vec3>& outStarts, std::vector<Vec3>& outEnds) const {
+    const int count = getCapsuleCount();
+    for (int c = 0; c < count; ++c) {
+        const Mat4& m = bones[m_bones[c]];
+        outStarts[c] = m.topLeftCorner<3, 3>() * m_localStarts[c] + m.topRightCorner<3, 1>();
+        outEnds[c] = m.topLeftCorner<3, 3>() * m_localEnds[c] + m.topRightCorner<3, 1>();
+    }
+}
+
+void CapsuleSetCollider::setBoneTransforms(const std::vector<Mat4>& bones) {
+    if (static_cast<int>(bones.size()) < m_boneCount) {
+        Logger::warn("CapsuleSetCollider: expected " + std::to_string(m_boneCount) + " bone transforms, got "
+                     + std::to_string(bones.size()));
+        return;
+    }
+
+    m_boneTransforms = bones;
+    placeCapsules(bones, m_starts, m_ends);
+    m_previousStarts = m_frameStarts = m_targetStarts = m_starts;
+    m_previousEnds = m_frameEnds = m_targetEnds = m_ends;
+    rebuildTree();
+}
+
+void CapsuleSetCollider::setTargetBoneTransforms(const std::vector<Mat4>& bones) {
+    if (static_cast<int>(bones.size()) < m_boneCount) {
+        Logger::warn("CapsuleSetCollider: expected " + std::to_string(m_boneCount) + " bone transforms, got "
+                     + std::to_string(bones.size()));
+        return;
+    }
+
+    m_boneTransforms = bones;
+    placeCapsules(bones, m_targetStarts, m_targetEnds);
+}
+
+void CapsuleSetCollider::setFrameTime(Scalar alpha) {
+    m_previousStarts.swap(m_starts);
+    m_previousEnds.swap(m_ends);
+
+    const int count = getCapsuleCount();
+    for (int c = 0; c < count; ++c) {
+        m_starts[c] = m_frameStarts[c] + (m_targetStarts[c] - m_frameStarts[c]) * alpha;
+        m_ends[c] = m_frameEnds[c] + (m_targetEnds[c] - m_frameEnds[c]) * alpha;
+    }
+
+    if (!m_tree.empty())
+        m_tree.refit(m_starts, m_ends);
+}
+
+void CapsuleSetCollider::endFrame() {
+    m_starts = m_previousStarts = m_frameStarts = m_targetStarts;
+    m_ends = m_previousEnds = m_frameEnds = m_targetEnds;
+
+    // The skeleton may have moved far from the pose the tree was split on.
+    rebuildTree();
+}
+
+void CapsuleSetCollider::rebuildTree() {
+    const int count = getCapsuleCount();
+    std::vector<Triangle> segments;
+    segments.reserve(count);
+    for (int c = 0; c < count; ++c)
+        segments.emplace_back(c, c, c);
+
+    m_tree.build(segments, m_starts);
+    if (!m_tree.empty())
+        m_tree.refit(m_starts, m_ends);
+}
+
+void CapsuleSetCollider::resolveParticle(Vec3& position, Vec3& oldPosition, Scalar thickness,
+                                         std::vector<int>& candidates) const {
+    const Vec3 pad = Vec3::Constant(m_maxRadius + thickness);
+    m_tree.query(position - pad, position + pad, candidates);
+
+    // Keep the capsule the particle penetrates deepest.
+    Scalar bestGap = 0.0;
+    int best = -1;
+    Scalar bestT = 0.0;
+    Vec3 bestClosest = Vec3::Zero();
+    for (int c : candidates) {
+        Vec3 segment = m_ends[c] - m_starts[c];
+        Scalar segmentLenSq = segment.squaredNorm();
+
+        Scalar t = 0.0;
+        if (segmentLenSq > 1e-6)
+            t = std::clamp<Scalar>((position - m_starts[c]).dot(segment) / segmentLenSq, 0.0, 1.0);
+
+        Vec3 closestPoint = m_starts[c] + segment * t;
+        Scalar gap = (position - closestPoint).norm() - (m_radii[c] + thickness);
+        if (gap < bestGap) {
+            bestGap = gap;
+            best = c;
+            bestT = t;
+            bestClosest = closestPoint;
+        }
+    }
+    if (best < 0) return;
+
+    Vec3 diff = position - bestClosest;
+    Scalar dist = diff.norm();
+    if (dist < 1e-9) return;
+
+    Vec3 normal = diff / dist;
+    position = bestClosest + normal * (m_radii[best] + thickness);
+
+    Vec3 surfaceDisplacement = (m_starts[best] - m_previousStarts[best]) * (1 - bestT)
+                             + (m_ends[best] - m_previousEnds[best]) * bestT;
+    Vec3 velocity = position - oldPosition;
+
+    oldPosition = position - frictionVelocity(velocity, normal, surfaceDisplacement);
+}
+
+void CapsuleSetCollider::resolve(ParticleStore& particles, Scalar /*dt*/, Scalar thickness) {
+    if (m_tree.empty()) return;
+
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const int count = particles.size();
+
+    #pragma omp parallel
+    {
+        std::vector<int> candidates;
+
+        #pragma omp for schedule(static)
+        for (int i = 0; i < count; ++i)
+            resolveParticle(positions[i], oldPositions[i], thickness, candidates);
+    }
+}
+
+void CapsuleSetCollider::resolve(ParticleStore& particles, const std::vector<int>& ids, Scalar /*dt*/, Scalar thickness) {
+    if (m_tree.empty()) return;
+
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const int count = static_cast<int>(ids.size());
+
+    #pragma omp parallel
+    {
+        std::vector<int> candidates;
+
+        #pragma omp for schedule(static)
+        for (int k = 0; k < count; ++k)
+            resolveParticle(positions[ids[k]], oldPositions[ids[k]], thickness, candidates);
+    }
+}
+
+bool CapsuleSetCollider::getBounds(Vec3& outLower, Vec3& outUpper) const {
+    if (m_tree.empty()) return false;
+
+    const BVHNode& root = m_tree.getNodes()[0];
+    outLower = root.lower - Vec3::Constant(m_maxRadius);
+    outUpper = root.upper + Vec3::Constant(m_maxRadius);
+    return true;
+}
+
+}
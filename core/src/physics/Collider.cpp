@@ -5,4 +5,15 @@
 
 namespace ClothSDK {
 
+void Collider::resolve(ParticleStore& particles, const std::vector<int>& /*candidates*/, Scalar dt, Scalar thickness) {
+    resolve(particles, dt, thickness);
+}
+
+Vec3 Collider::frictionVelocity(const Vec3& velocity, const Vec3& normal, const Vec3& surfaceDisplacement) const {
+    Vec3 slip = velocity - surfaceDisplacement;
+    Vec3 tangentSlip = slip - normal * slip.dot(normal);
+
+    return velocity - tangentSlip * m_friction;
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/ConstraintColoring.hpp"
+#include <cstdint>
+
+namespace ClothSDK {
+
+int ConstraintColoring::colorize(int particleCount, const std::vector<int>& offsets, const std::vector<int>& ids, std::vector<int>& outColors) {
+    const int constraintCount = static_cast<int>(offsets.size()) - 1;
+    outColors.assign(constraintCount > 0 ? constraintCount : 0, MaxColors);
+
+    // Bit c of usedColors[p] is set when particle p already belongs to a constraint of color c.
+    std::vector<uint64_t> usedColors(particleCount, 0);
+    int colorCount = 0;
+    bool overflow = false;
+
+    for (int i = 0; i < constraintCount; ++i) {
+        int begin = offsets[i];
+        int end = offsets[i + 1];
+
+        if (begin == end) {
+            overflow = true;
+            continue;
+        }
+
+        uint64_t used = 0;
+        for (int k = begin; k < end; ++k)
+            used |= usedColors[ids[k]];
+
+        if (used == ~uint64_t(0)) {
+            overflow = true;
+            continue;
+        }
+
+        int color = 0;
+        while (used & (uint64_t(1) << color))
+            ++color;
+
+        outColors[i] = color;
+        for (int k = begin; k < end; ++k)
+            usedColors[ids[k]] |= (uint64_t(1) << color);
+
+        if (color + 1 > colorCount)
+            colorCount = color + 1;
+    }
+
+    return overflow ? colorCount + 1 : colorCount;
+}
+
+void ConstraintColoring::buildBatches(const std::vector<int>& colors, std::vector<int>& outOrder, std::vector<int>& outBatchOffsets, std::vector<int>& outBatchColors) {
+    std::vector<int> counts(MaxColors + 1, 0);
+    for (int color : colors)
+        counts[color]++;
+
+    std::vector<int> starts(MaxColors + 1, 0);
+    outBatchOffsets.clear();
+    outBatchColors.clear();
+
+    int sum = 0;
+    for (int c = 0; c <= MaxColors; ++c) {
+        starts[c] = sum;
+        if (counts[c] > 0) {
+            outBatchOffsets.push_back(sum);
+            outBatchColors.push_back(c);
+        }
+        sum += counts[c];
+    }
+    outBatchOffsets.push_back(sum);
+
+    outOrder.resize(colors.size());
+    for (int i = 0; i < static_cast<int>(colors.size()); ++i)
+        outOrder[starts[colors[i]]++] = i;
+}
+
+}
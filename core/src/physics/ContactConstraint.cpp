@@ -2,39 +2,38 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "physics/ContactConstraint.hpp"
-#include "physics/Particle.hpp"
 #include <Eigen/Dense>
 
 namespace ClothSDK {
 
-ContactConstraint::ContactConstraint(int idA, int idB, double thickness, double compliance)
-: m_idA(idA), m_idB(idB), m_thickness(thickness) { m_compliance = compliance; }
+ContactConstraint::ContactConstraint(int idA, int idB, Scalar thickness, Scalar compliance)
+: idA(idA), idB(idB), thickness(thickness), compliance(compliance), lambda(0.0) {}
 
-void ContactConstraint::solve(std::vector<Particle>& particles, double dt)
+void ContactConstraint::solve(ParticleStore& particles, Scalar dt)
 {
-    Particle& pA = particles[m_idA];
-    Particle& pB = particles[m_idB];
+    const Vec3& xA = particles.getPosition(idA);
+    const Vec3& xB = particles.getPosition(idB);
 
-    Eigen::Vector3d d = pA.getPosition() - pB.getPosition();
-    double dist = d.norm();
+    Vec3 d = xA - xB;
+    Scalar dist = d.norm();
 
-    if (dist >= m_thickness || dist < 1e-8)
+    if (dist >= thickness || dist < 1e-8)
         return;
 
-    Eigen::Vector3d n = d / dist;
+    Vec3 n = d / dist;
 
-    double C = dist - m_thickness; 
+    Scalar C = dist - thickness; 
 
-    double wA = pA.getInverseMass();
-    double wB = pB.getInverseMass();
-    double wSum = wA + wB;
+    Scalar wA = particles.getInverseMass(idA);
+    Scalar wB = particles.getInverseMass(idB);
+    Scalar wSum = wA + wB;
     if (wSum == 0.0)
         return;
 
-    double correction = -C / wSum;
+    Scalar correction = -C / wSum;
 
-    pA.setPosition(pA.getPosition() + wA * correction * n);
-    pB.setPosition(pB.getPosition() - wB * correction * n);
+    particles.setPosition(idA, xA + wA * correction * n);
+    particles.setPosition(idB, xB - wB * correction * n);
 }
 
 
@@ -0,0 +1,148 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/ContinuousCollision.hpp"
+#include "physics/Proximity.hpp"
+#include <algorithm>
+#include <cmath>
+#include <Eigen/Dense>
+
+namespace ClothSDK {
+
+namespace {
+
+    /**
+     * Coefficients of (A + t a) x (B + t b) . (C + t c), the signed volume spanned by three
+     * linearly moving vectors, in increasing powers of t.
+     */
+    void coplanarityCubic(const Vec3& A, const Vec3& a, const Vec3& B, const Vec3& b, const Vec3& C, const Vec3& c, Scalar out[4]) {
+        const Vec3 AxB = A.cross(B);
+        const Vec3 mixed = a.cross(B) + A.cross(b);
+        const Vec3 axb = a.cross(b);
+        out[0] = AxB.dot(C);
+        out[1] = mixed.dot(C) + AxB.dot(c);
+        out[2] = axb.dot(C) + mixed.dot(c);
+        out[3] = axb.dot(c);
+    }
+
+}
+
+int ContinuousCollision::solveCubic(Scalar c0, Scalar c1, Scalar c2, Scalar c3, Scalar outRoots[3]) {
+    // Root finding runs in double so the float build does not lose roots to cancellation.
+    const double k0 = c0, k1 = c1, k2 = c2, k3 = c3;
+    auto f = [&](double t) { return ((k3 * t + k2) * t + k1) * t + k0; };
+
+    // Split [0, 1] at the roots of the derivative 3 k3 t^2 + 2 k2 t + k1.
+    double splits[4] = { 0.0, 0.0, 0.0, 0.0 };
+    int splitCount = 0;
+    splits[splitCount++] = 0.0;
+
+    const double qa = 3.0 * k3;
+    const double qb = 2.0 * k2;
+    const double qc = k1;
+    double critical[2];
+    int criticalCount = 0;
+    if (qa != 0.0) {
+        const double disc = qb * qb - 4.0 * qa * qc;
+        if (disc >= 0.0) {
+            const double s = std::sqrt(disc);
+            critical[criticalCount++] = (-qb - s) / (2.0 * qa);
+            critical[criticalCount++] = (-qb + s) / (2.0 * qa);
+            if (critical[0] > critical[1]) std::swap(critical[0], critical[1]);
+        }
+    } else if (qb != 0.0) {
+        critical[criticalCount++] = -qc / qb;
+    }
+    for (int k = 0; k < criticalCount; ++k) {
+        if (critical[k] > 0.0 && critical[k] < 1.0)
+            splits[splitCount++] = critical[k];
+    }
+    splits[splitCount++] = 1.0;
+
+    int rootCount = 0;
+    for (int k = 0; k + 1 < splitCount && rootCount < 3; ++k) {
+        double lo = splits[k];
+        double hi = splits[k + 1];
+        double flo = f(lo);
+        const double fhi = f(hi);
+
+        if (flo == 0.0) {
+            if (rootCount == 0 || outRoots[rootCount - 1] != static_cast<Scalar>(lo))
+                outRoots[rootCount++] = static_cast<Scalar>(lo);
+            continue;
+        }
+        if ((flo < 0.0) == (fhi < 0.0))
+            continue;
+
+        for (int iteration = 0; iteration < 64 && hi - lo > 1e-12; ++iteration) {
+            const double mid = 0.5 * (lo + hi);
+            const double fmid = f(mid);
+            if ((fmid < 0.0) == (flo < 0.0)) {
+                lo = mid;
+                flo = fmid;
+            } else {
+                hi = mid;
+            }
+        }
+        outRoots[rootCount++] = static_cast<Scalar>(0.5 * (lo + hi));
+    }
+
+    if (rootCount < 3 && f(1.0) == 0.0 && (rootCount == 0 || outRoots[rootCount - 1] != 1.0))
+        outRoots[rootCount++] = 1.0;
+
+    return rootCount;
+}
+
+bool ContinuousCollision::vertexTriangle(const Vec3& p0, const Vec3& p1,
+                                         const Vec3& a0, const Vec3& a1,
+                                         const Vec3& b0, const Vec3& b1,
+                                         const Vec3& c0, const Vec3& c1,
+                                         Scalar tolerance, Scalar& outTime, Vec3& outBary) {
+    const Vec3 A = b0 - a0;
+    const Vec3 B = c0 - a0;
+    const Vec3 C = p0 - a0;
+    Scalar coefficients[4];
+    coplanarityCubic(A, (b1 - a1) - A, B, (c1 - a1) - B, C, (p1 - a1) - C, coefficients);
+
+    Scalar roots[3];
+    const int rootCount = solveCubic(coefficients[0], coefficients[1], coefficients[2], coefficients[3], roots);
+
+    for (int k = 0; k < rootCount; ++k) {
+        const Scalar t = roots[k];
+        const Vec3 p = p0 + (p1 - p0) * t;
+        const Vec3 q = Proximity::closestPointOnTriangle(p, a0 + (a1 - a0) * t, b0 + (b1 - b0) * t, c0 + (c1 - c0) * t, outBary);
+        if ((p - q).squaredNorm() <= tolerance * tolerance) {
+            outTime = t;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ContinuousCollision::edgeEdge(const Vec3& a0, const Vec3& a1,
+                                   const Vec3& b0, const Vec3& b1,
+                                   const Vec3& c0, const Vec3& c1,
+                                   const Vec3& d0, const Vec3& d1,
+                                   Scalar tolerance, Scalar& outTime, Scalar& outS, Scalar& outT) {
+    const Vec3 A = b0 - a0;
+    const Vec3 B = d0 - c0;
+    const Vec3 C = c0 - a0;
+    Scalar coefficients[4];
+    coplanarityCubic(A, (b1 - a1) - A, B, (d1 - c1) - B, C, (c1 - a1) - C, coefficients);
+
+    Scalar roots[3];
+    const int rootCount = solveCubic(coefficients[0], coefficients[1], coefficients[2], coefficients[3], roots);
+
+    for (int k = 0; k < rootCount; ++k) {
+        const Scalar t = roots[k];
+        const Scalar distSq = Proximity::closestPointsOnSegments(a0 + (a1 - a0) * t, b0 + (b1 - b0) * t,
+                                                                 c0 + (c1 - c0) * t, d0 + (d1 - d0) * t, outS, outT);
+        if (distSq <= tolerance * tolerance) {
+            outTime = t;
+            return true;
+        }
+    }
+    return false;
+}
+
+}
@@ -2,37 +2,43 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "physics/DistanceConstraint.hpp"
+#include "physics/ParticleStore.hpp"
 
 namespace ClothSDK {
 
-DistanceConstraint::DistanceConstraint(int idA, int idB, double restLength, double compliance)
-: m_idA(idA), m_idB(idB), m_restLength(restLength), m_compliance(compliance) {}
+DistanceConstraint::DistanceConstraint(int idA, int idB, Scalar restLength, Scalar compliance)
+: idA(idA), idB(idB), restLength(restLength), compliance(compliance), lambda(0.0) {}
 
-void DistanceConstraint::solve(std::vector<Particle>& particles, double dt) {
-    Particle& pA = particles[m_idA];
-    Particle& pB = particles[m_idB];
+void DistanceConstraint::solve(ParticleStore& particles, Scalar dt, ConstraintResidual* residual) {
+    const Vec3& xA = particles.getPosition(idA);
+    const Vec3& xB = particles.getPosition(idB);
 
-    Eigen::Vector3d delta = pA.getPosition() - pB.getPosition();
-    double currentLength = delta.norm();
+    Vec3 delta = xA - xB;
+    Scalar currentLength = delta.norm();
 
     if (currentLength < 1e-6)
         return;
 
-    double wA = pA.getInverseMass();
-    double wB = pB.getInverseMass();
-    double wSum = wA + wB;
+    Scalar wA = particles.getInverseMass(idA);
+    Scalar wB = particles.getInverseMass(idB);
+    Scalar wSum = wA + wB;
     if (wSum == 0.0)
         return;
 
-    Eigen::Vector3d n = delta / currentLength;
-    double C = currentLength - m_restLength;  
+    Vec3 n = delta / currentLength;
+    Scalar C = currentLength - restLength;  
+    if (residual) residual->add(C);
 
-    double alphaHat = m_compliance / (dt * dt);
-    double deltaLambda = (-C - alphaHat * m_lambda) / (wSum + alphaHat);
-    m_lambda += deltaLambda;
+    Scalar alphaHat = compliance / (dt * dt);
+    Scalar deltaLambda = (-C - alphaHat * lambda) / (wSum + alphaHat);
+    lambda += deltaLambda;
 
-    pA.setPosition(pA.getPosition() + wA * n * deltaLambda);
-    pB.setPosition(pB.getPosition() - wB * n * deltaLambda);
+    particles.setPosition(idA, xA + wA * n * deltaLambda);
+    particles.setPosition(idB, xB - wB * n * deltaLambda);
+}
+
+Scalar DistanceConstraint::evaluate(const ParticleStore& particles) const {
+    return (particles.getPosition(idA) - particles.getPosition(idB)).norm() - restLength;
 }
 
 }
@@ -0,0 +1,125 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/DistanceKernel.hpp"
+#include "simd/DistanceKernelSimd.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace ClothSDK {
+
+namespace {
+
+bool cpuSupports(SimdLevel level) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    switch (level) {
+        case SimdLevel::Scalar: return true;
+        case SimdLevel::SSE2:   return __builtin_cpu_supports("sse2");
+        case SimdLevel::AVX2:   return __builtin_cpu_supports("avx2");
+        case SimdLevel::AVX512: return __builtin_cpu_supports("avx512f");
+    }
+    return false;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    const bool sse2 = (info[3] & (1 << 26)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    const bool osAvx = (xcr0 & 0x6) == 0x6;
+    const bool osAvx512 = (xcr0 & 0xE6) == 0xE6;
+
+    int extended[4] = { 0, 0, 0, 0 };
+    if (maxLeaf >= 7)
+        __cpuidex(extended, 7, 0);
+
+    switch (level) {
+        case SimdLevel::Scalar: return true;
+        case SimdLevel::SSE2:   return sse2;
+        case SimdLevel::AVX2:   return osAvx && (extended[1] & (1 << 5)) != 0;
+        case SimdLevel::AVX512: return osAvx512 && (extended[1] & (1 << 16)) != 0;
+    }
+    return false;
+#else
+    return level == SimdLevel::Scalar;
+#endif
+}
+
+bool isCompiled(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar: return true;
+#ifdef CLOTHSDK_SIMD_SSE2
+        case SimdLevel::SSE2:   return true;
+#endif
+#ifdef CLOTHSDK_SIMD_AVX2
+        case SimdLevel::AVX2:   return true;
+#endif
+#ifdef CLOTHSDK_SIMD_AVX512
+        case SimdLevel::AVX512: return true;
+#endif
+        default: return false;
+    }
+}
+
+}
+
+SimdLevel DistanceKernel::detect() {
+    if (isSupported(SimdLevel::AVX512)) return SimdLevel::AVX512;
+    if (isSupported(SimdLevel::AVX2)) return SimdLevel::AVX2;
+    if (isSupported(SimdLevel::SSE2)) return SimdLevel::SSE2;
+    return SimdLevel::Scalar;
+}
+
+bool DistanceKernel::isSupported(SimdLevel level) {
+    return isCompiled(level) && cpuSupports(level);
+}
+
+const char* DistanceKernel::toString(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar: return "Scalar";
+        case SimdLevel::SSE2:   return "SSE2";
+        case SimdLevel::AVX2:   return "AVX2";
+        case SimdLevel::AVX512: return "AVX512";
+    }
+    return "Unknown";
+}
+
+static_assert(sizeof(Vec3) == 3 * sizeof(Scalar), "SIMD kernels assume tightly packed positions");
+
+void DistanceKernel::solveBatch(DistanceConstraint* constraints, int count, ParticleStore& particles, Scalar dt, SimdLevel level,
+                                ConstraintResidual* residual) {
+    if (count <= 0) return;
+
+    Scalar* positions = particles.getPositions().data()->data();
+    const Scalar* inverseMasses = particles.getInverseMasses().data();
+    int done = 0;
+
+    switch (level) {
+#ifdef CLOTHSDK_SIMD_AVX512
+        case SimdLevel::AVX512:
+            done = simd::solveDistanceBatchAVX512(constraints, count, positions, inverseMasses, dt, residual);
+            break;
+#endif
+#ifdef CLOTHSDK_SIMD_AVX2
+        case SimdLevel::AVX2:
+            done = simd::solveDistanceBatchAVX2(constraints, count, positions, inverseMasses, dt, residual);
+            break;
+#endif
+#ifdef CLOTHSDK_SIMD_SSE2
+        case SimdLevel::SSE2:
+            done = simd::solveDistanceBatchSSE2(constraints, count, positions, inverseMasses, dt, residual);
+            break;
+#endif
+        default:
+            break;
+    }
+
+    for (int i = done; i < count; ++i)
+        constraints[i].solve(particles, dt, residual);
+}
+
+}
@@ -5,13 +5,13 @@
 
 namespace ClothSDK {
 
-void GravityForce::apply(std::vector<Particle>& particles, double dt) {
+void GravityForce::apply(ParticleStore& particles, Scalar dt) {
     #pragma omp parallel for
-    for (auto& p : particles) {
-        if (p.getInverseMass() == 0.0)
+    for (int i = 0; i < particles.size(); ++i) {
+        if (particles.getInverseMass(i) == 0.0)
             continue;
 
-        p.addForce(m_gravity);
+        particles.addForce(i, m_gravity);
     }
 }
 
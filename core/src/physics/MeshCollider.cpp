@@ -0,0 +1,256 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/MeshCollider.hpp"
+#include "physics/ParticleStore.hpp"
+#include "physics/Proximity.hpp"
+#include "io/OBJLoader.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <Eigen/Dense>
+#include <tuple>
+
+namespace ClothSDK {
+
+MeshCollider::MeshCollider(const std::vector<Vec3>& vertices, const std::vector<Triangle>& triangles, Scalar friction)
+    : m_vertices(vertices)
+{
+    m_friction = friction;
+    setTransform(Mat3::Identity(), Vec3::Zero());
+
+    // The divergence theorem gives six times the enclosed volume; a negative one means
+    // the faces point inwards.
+    Scalar volume = 0.0;
+    for (const Triangle& tri : triangles)
+        volume += vertices[tri.a].dot(vertices[tri.b].cross(vertices[tri.c]));
+
+    std::vector<Triangle> oriented = triangles;
+    if (volume < 0.0) {
+        for (Triangle& tri : oriented)
+            std::swap(tri.b, tri.c);
+    }
+
+    m_bvh.build(oriented, m_vertices);
+    computePseudoNormals();
+}
+
+std::unique_ptr<MeshCollider> MeshCollider::fromOBJ(const std::string& path, Scalar friction) {
+    std::vector<Vec3> vertices;
+    std::vector<int> indices;
+    if (!OBJLoader::load(path, vertices, indices) || indices.size() % 3 != 0) {
+        Logger::error("MeshCollider: could not load a triangle mesh from " + path);
+        return nullptr;
+    }
+
+    std::vector<Triangle> triangles;
+    triangles.reserve(indices.size() / 3);
+    for (size_t k = 0; k < indices.size(); k += 3)
+        triangles.emplace_back(indices[k], indices[k + 1], indices[k + 2]);
+
+    return std::make_unique<MeshCollider>(vertices, triangles, friction);
+}
+
+void MeshCollider::computePseudoNormals() {
+    const auto& triangles = m_bvh.getTriangles();
+    const int triangleCount = static_cast<int>(triangles.size());
+
+    m_faceNormals.assign(triangleCount, Vec3::Zero());
+    m_vertexNormals.assign(m_vertices.size(), Vec3::Zero());
+    m_edgeNormals.assign(3 * triangleCount, Vec3::Zero());
+
+    std::vector<std::tuple<int, int, int>> edges;
+    edges.reserve(3 * triangleCount);
+
+    for (int t = 0; t < triangleCount; ++t) {
+        const int ids[3] = { triangles[t].a, triangles[t].b, triangles[t].c };
+        const Vec3 normal = (m_vertices[ids[1]] - m_vertices[ids[0]]).cross(m_vertices[ids[2]] - m_vertices[ids[0]]);
+        if (normal.squaredNorm() < 1e-24) continue;
+        m_faceNormals[t] = normal.normalized();
+
+        for (int k = 0; k < 3; ++k) {
+            const Vec3 toNext = (m_vertices[ids[(k + 1) % 3]] - m_vertices[ids[k]]).normalized();
+            const Vec3 toPrev = (m_vertices[ids[(k + 2) % 3]] - m_vertices[ids[k]]).normalized();
+            const Scalar angle = std::acos(std::clamp(toNext.dot(toPrev), Scalar(-1.0), Scalar(1.0)));
+            m_vertexNormals[ids[k]] += m_faceNormals[t] * angle;
+
+            edges.emplace_back(std::min(ids[k], ids[(k + 1) % 3]), std::max(ids[k], ids[(k + 1) % 3]), 3 * t + k);
+        }
+    }
+
+    // Slots sharing an edge are adjacent after sorting; each gets the sum of their faces.
+    std::sort(edges.begin(), edges.end());
+    for (size_t first = 0; first < edges.size();) {
+        size_t last = first;
+        Vec3 normal = Vec3::Zero();
+        while (last < edges.size() && std::get<0>(edges[last]) == std::get<0>(edges[first]) &&
+               std::get<1>(edges[last]) == std::get<1>(edges[first])) {
+            normal += m_faceNormals[std::get<2>(edges[last]) / 3];
+            ++last;
+        }
+        for (size_t k = first; k < last; ++k)
+            m_edgeNormals[std::get<2>(edges[k])] = normal;
+        first = last;
+    }
+
+    for (Vec3& normal : m_edgeNormals)
+        if (normal.squaredNorm() > 1e-24) normal.normalize();
+    for (Vec3& normal : m_vertexNormals)
+        if (normal.squaredNorm() > 1e-24) normal.normalize();
+}
+
+void MeshCollider::closestFeature(const Vec3& point, const std::vector<int>& candidates, Vec3& outPoint, Vec3& outNormal) const {
+    const auto& triangles = m_bvh.getTriangles();
+
+    int closest = -1;
+    Scalar closestDistSq = 0.0;
+    Vec3 closestBary = Vec3::Zero();
+    for (int t : candidates) {
+        const Triangle& tri = triangles[t];
+        Vec3 bary;
+        const Vec3 q = Proximity::closestPointOnTriangle(point, m_vertices[tri.a], m_vertices[tri.b], m_vertices[tri.c], bary);
+        const Scalar distSq = (point - q).squaredNorm();
+        if (closest < 0 || distSq < closestDistSq) {
+            closest = t;
+            closestDistSq = distSq;
+            outPoint = q;
+            closestBary = bary;
+        }
+    }
+
+    // The pseudo-normal of the closest feature decides the side.
+    const Triangle& tri = triangles[closest];
+    if (closestBary.y() == 0.0 && closestBary.z() == 0.0) outNormal = m_vertexNormals[tri.a];
+    else if (closestBary.x() == 0.0 && closestBary.z() == 0.0) outNormal = m_vertexNormals[tri.b];
+    else if (closestBary.x() == 0.0 && closestBary.y() == 0.0) outNormal = m_vertexNormals[tri.c];
+    else if (closestBary.z() == 0.0) outNormal = m_edgeNormals[3 * closest];
+    else if (closestBary.x() == 0.0) outNormal = m_edgeNormals[3 * closest + 1];
+    else if (closestBary.y() == 0.0) outNormal = m_edgeNormals[3 * closest + 2];
+    else outNormal = m_faceNormals[closest];
+}
+
+bool MeshCollider::signedDistance(const Vec3& point, Scalar radius, std::vector<int>& candidates, Scalar& outDistance) const {
+    const Vec3 pad = Vec3::Constant(radius);
+    m_bvh.query(point - pad, point + pad, candidates);
+    if (candidates.empty()) return false;
+
+    Vec3 closestPoint, featureNormal;
+    closestFeature(point, candidates, closestPoint, featureNormal);
+
+    const Vec3 diff = point - closestPoint;
+    const Scalar distance = diff.norm();
+    if (distance > radius) return false;
+
+    outDistance = diff.dot(featureNormal) < 0.0 ? -distance : distance;
+    return true;
+}
+
+void MeshCollider::setTransform(const Mat3& rotation, const Vec3& translation) {
+    m_rotation = m_previousRotation = rotation;
+    m_translation = m_previousTranslation = translation;
+    m_frameRotation = m_targetRotation = Eigen::Quaternion<Scalar>(rotation).normalized();
+    m_frameTranslation = m_targetTranslation = translation;
+}
+
+void MeshCollider::setTargetTransform(const Mat3& rotation, const Vec3& translation) {
+    m_targetRotation = Eigen::Quaternion<Scalar>(rotation).normalized();
+    m_targetTranslation = translation;
+}
+
+void MeshCollider::setFrameTime(Scalar alpha) {
+    m_previousRotation = m_rotation;
+    m_previousTranslation = m_translation;
+    m_rotation = m_frameRotation.slerp(alpha, m_targetRotation).toRotationMatrix();
+    m_translation = m_frameTranslation + (m_targetTranslation - m_frameTranslation) * alpha;
+}
+
+void MeshCollider::endFrame() {
+    setTransform(m_targetRotation.toRotationMatrix(), m_targetTranslation);
+}
+
+void MeshCollider::resolveParticle(Vec3& position, Vec3& oldPosition, const Mat3& toLocal, Scalar thickness,
+                                   std::vector<int>& candidates) const {
+    const Vec3 local = toLocal * (position - m_translation);
+    // The old position is taken into the frame the mesh had at the start of the
+    // substep, so the motion box follows the particle relative to a moving mesh.
+    const Vec3 localOld = m_previousRotation.transpose() * (oldPosition - m_previousTranslation);
+    const Vec3 pad = Vec3::Constant(thickness);
+
+    // The box of the whole substep motion only widens the candidate search; the
+    // contact itself is the closest feature to the current position, so a particle
+    // that tunnelled through a thin part of the mesh within one substep is not caught.
+    m_bvh.query(local.cwiseMin(localOld) - pad, local.cwiseMax(localOld) + pad, candidates);
+    if (candidates.empty()) return;
+
+    Vec3 closestPoint, featureNormal;
+    closestFeature(local, candidates, closestPoint, featureNormal);
+
+    const Vec3 diff = local - closestPoint;
+    const Scalar distance = diff.norm();
+    const bool inside = diff.dot(featureNormal) < 0.0;
+    if (!inside && distance >= thickness) return;
+
+    const Vec3 localNormal = (inside || distance < 1e-9) ? featureNormal : Vec3(diff / distance);
+    const Vec3 normal = m_rotation * localNormal;
+
+    const Vec3 contact = closestPoint + localNormal * thickness;
+    position = m_rotation * contact + m_translation;
+
+    const Vec3 surfaceDisplacement = (m_rotation - m_previousRotation) * contact + (m_translation - m_previousTranslation);
+    Vec3 velocity = position - oldPosition;
+
+    oldPosition = position - frictionVelocity(velocity, normal, surfaceDisplacement);
+}
+
+void MeshCollider::resolve(ParticleStore& particles, Scalar /*dt*/, Scalar thickness) {
+    if (m_bvh.empty()) return;
+
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const Mat3 toLocal = m_rotation.transpose();
+    const int count = particles.size();
+
+    #pragma omp parallel
+    {
+        std::vector<int> candidates;
+
+        #pragma omp for schedule(static)
+        for (int i = 0; i < count; ++i)
+            resolveParticle(positions[i], oldPositions[i], toLocal, thickness, candidates);
+    }
+}
+
+void MeshCollider::resolve(ParticleStore& particles, const std::vector<int>& ids, Scalar /*dt*/, Scalar thickness) {
+    if (m_bvh.empty()) return;
+
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const Mat3 toLocal = m_rotation.transpose();
+    const int count = static_cast<int>(ids.size());
+
+    #pragma omp parallel
+    {
+        std::vector<int> candidates;
+
+        #pragma omp for schedule(static)
+        for (int k = 0; k < count; ++k)
+            resolveParticle(positions[ids[k]], oldPositions[ids[k]], toLocal, thickness, candidates);
+    }
+}
+
+bool MeshCollider::getBounds(Vec3& outLower, Vec3& outUpper) const {
+    if (m_bvh.empty()) return false;
+
+    const BVHNode& root = m_bvh.getNodes()[0];
+    for (int corner = 0; corner < 8; ++corner) {
+        const Vec3 local((corner & 1) ? root.upper.x() : root.lower.x(),
+                         (corner & 2) ? root.upper.y() : root.lower.y(),
+                         (corner & 4) ? root.upper.z() : root.lower.z());
+        const Vec3 world = m_rotation * local + m_translation;
+        outLower = corner == 0 ? world : Vec3(outLower.cwiseMin(world));
+        outUpper = corner == 0 ? world : Vec3(outUpper.cwiseMax(world));
+    }
+    return true;
+}
+
+}
@@ -5,25 +5,25 @@
 
 namespace ClothSDK {
 
-Particle::Particle(const Eigen::Vector3d& pos) : m_position(pos), m_oldPosition(pos), m_acceleration(Eigen::Vector3d::Zero()), inverseMass(1.0) {}
+Particle::Particle(const Vec3& pos) : m_position(pos), m_oldPosition(pos), m_acceleration(Vec3::Zero()), inverseMass(1.0) {}
 
-void Particle::addForce(const Eigen::Vector3d& force) {
+void Particle::addForce(const Vec3& force) {
     m_acceleration += force * inverseMass;
 }
 
 void Particle::clearForces() {
-    m_acceleration = Eigen::Vector3d::Zero();
+    m_acceleration = Vec3::Zero();
 }
 
-void Particle::integrate(double deltaTime) {
+void Particle::integrate(Scalar deltaTime, Scalar damping) {
     if (inverseMass <= 0.0) {
-        m_acceleration = Eigen::Vector3d::Zero();
+        m_acceleration = Vec3::Zero();
         m_oldPosition = m_position; 
         return;
     }
 
-    Eigen::Vector3d velocity = (m_position - m_oldPosition) * 0.98;
-    Eigen::Vector3d currentPos = m_position;
+    Vec3 velocity = (m_position - m_oldPosition) * damping;
+    Vec3 currentPos = m_position;
 
     m_position = m_position + velocity + m_acceleration * (deltaTime * deltaTime);
     
@@ -31,22 +31,22 @@ void Particle::integrate(double deltaTime) {
     clearForces();
 }
 
-void Particle::setPosition(const Eigen::Vector3d& newPosition) {
+void Particle::setPosition(const Vec3& newPosition) {
     m_position = newPosition;
 }
 
-void Particle::setInverseMass(double invMass) {
+void Particle::setInverseMass(Scalar invMass) {
     inverseMass = invMass;
 }
 
-void Particle::setOldPosition(const Eigen::Vector3d& newOldPosition) {
+void Particle::setOldPosition(const Vec3& newOldPosition) {
     m_oldPosition = newOldPosition;
 }
 
-void Particle::addMass(double mass) {
+void Particle::addMass(Scalar mass) {
     if (inverseMass == 0.0) return;
 
-    double currentMass = 1.0 / inverseMass;
+    Scalar currentMass = 1.0 / inverseMass;
     currentMass += mass;
     inverseMass = 1.0 / currentMass;
 }
@@ -0,0 +1,108 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/ParticleAdjacency.hpp"
+#include <algorithm>
+
+namespace ClothSDK {
+
+void ParticleAdjacency::clear() {
+    m_edges.clear();
+    m_offsets.clear();
+    m_neighbors.clear();
+}
+
+void ParticleAdjacency::addEdge(int idA, int idB) {
+    if (idA == idB) return;
+    m_edges.emplace_back(idA, idB);
+}
+
+void ParticleAdjacency::remap(const std::vector<int>& newIndex) {
+    for (auto& edge : m_edges) {
+        edge.first = newIndex[edge.first];
+        edge.second = newIndex[edge.second];
+    }
+    m_offsets.clear();
+    m_neighbors.clear();
+}
+
+void ParticleAdjacency::build(int particleCount, int rings) {
+    m_rings = std::max(rings, 1);
+    buildDirect(particleCount);
+    if (m_rings == 1) return;
+
+    // Each row of the k-ring is a breadth-first search of depth k over the 1-ring rows.
+    const std::vector<int> directOffsets = m_offsets;
+    const std::vector<int> directNeighbors = m_neighbors;
+    std::vector<std::vector<int>> rows(particleCount);
+
+    #pragma omp parallel
+    {
+        std::vector<int> visited(particleCount, -1);
+        std::vector<int> frontier;
+        std::vector<int> next;
+
+        #pragma omp for schedule(dynamic, 256)
+        for (int i = 0; i < particleCount; ++i) {
+            std::vector<int>& row = rows[i];
+            visited[i] = i;
+            frontier.assign(1, i);
+
+            for (int depth = 0; depth < m_rings && !frontier.empty(); ++depth) {
+                next.clear();
+                for (int p : frontier) {
+                    for (int k = directOffsets[p]; k < directOffsets[p + 1]; ++k) {
+                        int q = directNeighbors[k];
+                        if (visited[q] == i) continue;
+                        visited[q] = i;
+                        next.push_back(q);
+                        row.push_back(q);
+                    }
+                }
+                frontier.swap(next);
+            }
+
+            std::sort(row.begin(), row.end());
+        }
+    }
+
+    m_offsets.assign(particleCount + 1, 0);
+    for (int i = 0; i < particleCount; ++i)
+        m_offsets[i + 1] = m_offsets[i] + static_cast<int>(rows[i].size());
+
+    m_neighbors.resize(m_offsets[particleCount]);
+    for (int i = 0; i < particleCount; ++i)
+        std::copy(rows[i].begin(), rows[i].end(), m_neighbors.begin() + m_offsets[i]);
+}
+
+void ParticleAdjacency::buildDirect(int particleCount) {
+    m_offsets.assign(particleCount + 1, 0);
+    for (const auto& edge : m_edges) {
+        m_offsets[edge.first + 1]++;
+        m_offsets[edge.second + 1]++;
+    }
+    for (int i = 0; i < particleCount; ++i)
+        m_offsets[i + 1] += m_offsets[i];
+
+    std::vector<int> neighbors(m_offsets[particleCount]);
+    std::vector<int> cursor(m_offsets.begin(), m_offsets.end() - 1);
+    for (const auto& edge : m_edges) {
+        neighbors[cursor[edge.first]++] = edge.second;
+        neighbors[cursor[edge.second]++] = edge.first;
+    }
+
+    // Sort each row and drop repeated edges, compacting the rows in place.
+    m_neighbors.clear();
+    m_neighbors.reserve(neighbors.size());
+    int begin = 0;
+    for (int i = 0; i < particleCount; ++i) {
+        int end = m_offsets[i + 1];
+        std::sort(neighbors.begin() + begin, neighbors.begin() + end);
+        auto last = std::unique(neighbors.begin() + begin, neighbors.begin() + end);
+        m_neighbors.insert(m_neighbors.end(), neighbors.begin() + begin, last);
+        begin = end;
+        m_offsets[i + 1] = static_cast<int>(m_neighbors.size());
+    }
+}
+
+}
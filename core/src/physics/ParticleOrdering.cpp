@@ -0,0 +1,117 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/ParticleOrdering.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+
+namespace ClothSDK {
+
+namespace {
+
+    /** Spreads the low 21 bits of @p v so that two zero bits separate each of them. */
+    inline uint64_t spreadBits(uint64_t v) {
+        v &= 0x1fffff;
+        v = (v | (v << 32)) & 0x1f00000000ffffULL;
+        v = (v | (v << 16)) & 0x1f0000ff0000ffULL;
+        v = (v | (v << 8))  & 0x100f00f00f00f00fULL;
+        v = (v | (v << 4))  & 0x10c30c30c30c30c3ULL;
+        v = (v | (v << 2))  & 0x1249249249249249ULL;
+        return v;
+    }
+
+}
+
+void ParticleOrdering::mortonOrder(const std::vector<Vec3>& positions, std::vector<int>& outOrder) {
+    const int count = static_cast<int>(positions.size());
+    outOrder.resize(count);
+    if (count == 0) return;
+
+    Vec3 lower = positions[0];
+    Vec3 upper = positions[0];
+    for (const Vec3& p : positions) {
+        lower = lower.cwiseMin(p);
+        upper = upper.cwiseMax(p);
+    }
+
+    const double maxCell = static_cast<double>((1 << 21) - 1);
+    const double extent = std::max(static_cast<double>((upper - lower).maxCoeff()), 1e-12);
+    const double scale = maxCell / extent;
+
+    std::vector<std::pair<uint64_t, int>> keys(count);
+
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < count; ++i) {
+        const Vec3 local = positions[i] - lower;
+        const uint64_t x = static_cast<uint64_t>(std::min(static_cast<double>(local.x()) * scale, maxCell));
+        const uint64_t y = static_cast<uint64_t>(std::min(static_cast<double>(local.y()) * scale, maxCell));
+        const uint64_t z = static_cast<uint64_t>(std::min(static_cast<double>(local.z()) * scale, maxCell));
+        keys[i] = { spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2), i };
+    }
+
+    std::sort(keys.begin(), keys.end());
+    for (int k = 0; k < count; ++k)
+        outOrder[k] = keys[k].second;
+}
+
+void ParticleOrdering::reverseCuthillMcKee(const std::vector<int>& offsets, const std::vector<int>& neighbors, std::vector<int>& outOrder) {
+    const int count = offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
+    outOrder.clear();
+    outOrder.reserve(count);
+
+    auto degree = [&](int i) { return offsets[i + 1] - offsets[i]; };
+
+    // Component seeds are taken by increasing degree, which starts every component on
+    // one of its boundary particles for typical cloth meshes.
+    std::vector<int> seeds(count);
+    for (int i = 0; i < count; ++i) seeds[i] = i;
+    std::stable_sort(seeds.begin(), seeds.end(), [&](int a, int b) { return degree(a) < degree(b); });
+
+    std::vector<char> visited(count, 0);
+    std::vector<int> level;
+
+    for (int seed : seeds) {
+        if (visited[seed]) continue;
+        visited[seed] = 1;
+
+        size_t head = outOrder.size();
+        outOrder.push_back(seed);
+
+        while (head < outOrder.size()) {
+            const int p = outOrder[head++];
+
+            level.clear();
+            for (int k = offsets[p]; k < offsets[p + 1]; ++k) {
+                const int q = neighbors[k];
+                if (visited[q]) continue;
+                visited[q] = 1;
+                level.push_back(q);
+            }
+
+            std::stable_sort(level.begin(), level.end(), [&](int a, int b) { return degree(a) < degree(b); });
+            outOrder.insert(outOrder.end(), level.begin(), level.end());
+        }
+    }
+
+    std::reverse(outOrder.begin(), outOrder.end());
+}
+
+void ParticleOrdering::invert(const std::vector<int>& order, std::vector<int>& outNewIndex) {
+    outNewIndex.resize(order.size());
+    for (int k = 0; k < static_cast<int>(order.size()); ++k)
+        outNewIndex[order[k]] = k;
+}
+
+int ParticleOrdering::bandwidth(const std::vector<int>& offsets, const std::vector<int>& neighbors) {
+    const int count = offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
+    int result = 0;
+    for (int i = 0; i < count; ++i) {
+        for (int k = offsets[i]; k < offsets[i + 1]; ++k)
+            result = std::max(result, std::abs(neighbors[k] - i));
+    }
+    return result;
+}
+
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/ParticleStore.hpp"
+#include <type_traits>
+
+namespace ClothSDK {
+
+int ParticleStore::add(const Particle& particle) {
+    m_positions.push_back(particle.getPosition());
+    m_oldPositions.push_back(particle.getOldPosition());
+    m_accelerations.push_back(particle.getAcceleration());
+    m_inverseMasses.push_back(particle.getInverseMass());
+    return static_cast<int>(m_positions.size() - 1);
+}
+
+void ParticleStore::clear() {
+    m_positions.clear();
+    m_oldPositions.clear();
+    m_accelerations.clear();
+    m_inverseMasses.clear();
+}
+
+void ParticleStore::reserve(size_t count) {
+    m_positions.reserve(count);
+    m_oldPositions.reserve(count);
+    m_accelerations.reserve(count);
+    m_inverseMasses.reserve(count);
+}
+
+void ParticleStore::permute(const std::vector<int>& order) {
+    auto apply = [&order](auto& values) {
+        std::remove_reference_t<decltype(values)> permuted(values.size());
+        for (size_t k = 0; k < order.size(); ++k)
+            permuted[k] = values[order[k]];
+        values.swap(permuted);
+    };
+
+    apply(m_positions);
+    apply(m_oldPositions);
+    apply(m_accelerations);
+    apply(m_inverseMasses);
+}
+
+void ParticleStore::addMass(int id, Scalar mass) {
+    Scalar& inverseMass = m_inverseMasses[id];
+    if (inverseMass == 0.0) return;
+
+    Scalar currentMass = 1.0 / inverseMass;
+    currentMass += mass;
+    inverseMass = 1.0 / currentMass;
+}
+
+Particle ParticleStore::getParticle(int id) const {
+    Particle particle(m_positions[id]);
+    particle.setOldPosition(m_oldPositions[id]);
+    particle.setInverseMass(m_inverseMasses[id]);
+    if (m_inverseMasses[id] > 0.0)
+        particle.addForce(m_accelerations[id] / m_inverseMasses[id]);
+    return particle;
+}
+
+void ParticleStore::toParticles(std::vector<Particle>& outParticles) const {
+    outParticles.clear();
+    outParticles.reserve(m_positions.size());
+    for (int i = 0; i < size(); ++i) {
+        outParticles.push_back(getParticle(i));
+    }
+}
+
+}
@@ -4,31 +4,30 @@
 #include <Eigen/Dense>
 
 #include "physics/PinConstraint.hpp"
-#include "physics/Particle.hpp"
 
 namespace ClothSDK {
 
-PinConstraint::PinConstraint(int particleId, const Eigen::Vector3d& pinPosition, double compliance) : m_particleId(particleId), m_pinPos(pinPosition) { m_compliance = compliance; }
+PinConstraint::PinConstraint(int particleId, const Vec3& pinPosition, Scalar compliance) : particleId(particleId), pinPosition(pinPosition), compliance(compliance), lambda(0.0) {}
 
-void PinConstraint::solve(std::vector<Particle>& particles, double dt) {
-    Particle& p = particles[m_particleId];
-    Eigen::Vector3d dir = p.getPosition() - m_pinPos;
-    double dist = dir.norm();
+void PinConstraint::solve(ParticleStore& particles, Scalar dt) {
+    const Vec3& position = particles.getPosition(particleId);
+    Vec3 dir = position - pinPosition;
+    Scalar dist = dir.norm();
 
     if (dist < 1e-6) return;
 
-    Eigen::Vector3d n = dir / dist;
+    Vec3 n = dir / dist;
 
-    double alphaHat = m_compliance / (dt * dt);
-    double invMass = p.getInverseMass();
-    double denominator = invMass + alphaHat;
+    Scalar alphaHat = compliance / (dt * dt);
+    Scalar invMass = particles.getInverseMass(particleId);
+    Scalar denominator = invMass + alphaHat;
     
     if (denominator < 1e-12) return; 
 
-    double deltaLambda = (-dist - alphaHat * m_lambda) / denominator;
-    m_lambda += deltaLambda;
+    Scalar deltaLambda = (-dist - alphaHat * lambda) / denominator;
+    lambda += deltaLambda;
 
-    p.setPosition(p.getPosition() + n * (p.getInverseMass() * deltaLambda));
+    particles.setPosition(particleId, position + n * (invMass * deltaLambda));
 }
 
 }
\ No newline at end of file
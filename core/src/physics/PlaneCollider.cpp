@@ -2,38 +2,55 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "physics/PlaneCollider.hpp"
-#include "physics/Particle.hpp"
+#include "physics/ParticleStore.hpp"
 
 namespace ClothSDK {
 
-PlaneCollider::PlaneCollider(const Eigen::Vector3d& origin, const Eigen::Vector3d& normal, double friction) 
+PlaneCollider::PlaneCollider(const Vec3& origin, const Vec3& normal, Scalar friction) 
 : m_origin(origin), m_normal(normal.normalized()) {
     m_friction = friction;
 }
 
-void PlaneCollider::resolve(std::vector<Particle>& particles, double dt, double thickness) {
-    
-    for(auto& particle : particles) {
-        Eigen::Vector3d vec = particle.getPosition() - m_origin;
-        double distance = vec.dot(m_normal);
+void PlaneCollider::resolveParticle(Vec3& position, Vec3& oldPosition, Scalar thickness) const {
+    Vec3 vec = position - m_origin;
+    Scalar distance = vec.dot(m_normal);
 
-        if (distance < thickness) {
-            
-            double penetration = thickness - distance;
-            Eigen::Vector3d newPosition = particle.getPosition() + m_normal * penetration;
-            particle.setPosition(newPosition);
+    if (distance < thickness) {
+        
+        Scalar penetration = thickness - distance;
+        position += m_normal * penetration;
 
-            Eigen::Vector3d velocity = particle.getPosition() - particle.getOldPosition();
-            
-            double normalVelMag = velocity.dot(m_normal);
-            Eigen::Vector3d normalVel = m_normal * normalVelMag;
-            Eigen::Vector3d tangentVel = velocity - normalVel;
+        Vec3 velocity = position - oldPosition;
+        
+        Scalar normalVelMag = velocity.dot(m_normal);
+        Vec3 normalVel = m_normal * normalVelMag;
+        Vec3 tangentVel = velocity - normalVel;
 
-            Eigen::Vector3d newVelocity = normalVel + tangentVel * (1.0 - m_friction);
+        Vec3 newVelocity = normalVel + tangentVel * (1.0 - m_friction);
 
-            particle.setOldPosition(particle.getPosition() - newVelocity);
-        }
+        oldPosition = position - newVelocity;
     }
 }
 
+void PlaneCollider::resolve(ParticleStore& particles, Scalar dt, Scalar thickness) {
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+
+    const int count = particles.size();
+
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < count; ++i)
+        resolveParticle(positions[i], oldPositions[i], thickness);
+}
+
+void PlaneCollider::resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar /*dt*/, Scalar thickness) {
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const int count = static_cast<int>(candidates.size());
+
+    #pragma omp parallel for schedule(static)
+    for (int k = 0; k < count; ++k)
+        resolveParticle(positions[candidates[k]], oldPositions[candidates[k]], thickness);
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,281 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/SDFCollider.hpp"
+#include "physics/MeshCollider.hpp"
+#include "physics/ParticleStore.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace ClothSDK {
+
+namespace {
+
+    const char CacheMagic[4] = { 'C', 'S', 'D', 'F' };
+    const std::int32_t CacheVersion = 1;
+
+    // 512 MB of samples; also keeps every flat index within an int.
+    const size_t MaxSamples = size_t(1) << 27;
+
+}
+
+SDFCollider::SDFCollider(const MeshCollider& mesh, Scalar cellSize, int bandCells, Scalar friction)
+    : m_cellSize(cellSize), m_band(std::max(bandCells, 1) * cellSize)
+{
+    m_friction = friction;
+
+    if (!(cellSize > 0)) {
+        Logger::warn("SDFCollider: cell size must be positive, got " + std::to_string(cellSize) + "; the grid will be empty");
+        m_cellSize = 1.0;
+        m_band = 0.0;
+        return;
+    }
+
+    const Mat3& rotation = mesh.getRotation();
+    const Vec3& translation = mesh.getTranslation();
+    const auto& vertices = mesh.getVertices();
+    if (vertices.empty()) return;
+
+    Vec3 lower = rotation * vertices[0] + translation;
+    Vec3 upper = lower;
+    for (const Vec3& v : vertices) {
+        const Vec3 world = rotation * v + translation;
+        lower = lower.cwiseMin(world);
+        upper = upper.cwiseMax(world);
+    }
+
+    // The margin keeps every border sample outside the band, so the flood fill below
+    // starts from samples known to be outside.
+    const Scalar margin = m_band + cellSize;
+    m_origin = lower - Vec3::Constant(margin);
+    double samples = 1.0;
+    double axisSamples[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        axisSamples[axis] = std::ceil(static_cast<double>(upper[axis] - lower[axis] + 2.0 * margin) / cellSize) + 1.0;
+        samples *= axisSamples[axis];
+    }
+    if (!(samples <= static_cast<double>(MaxSamples))) {
+        Logger::warn("SDFCollider: a cell size of " + std::to_string(cellSize) + " needs more than " +
+                     std::to_string(MaxSamples) + " samples; the grid will be empty");
+        return;
+    }
+    for (int axis = 0; axis < 3; ++axis)
+        m_resolution[axis] = static_cast<int>(axisSamples[axis]);
+
+    const int count = m_resolution[0] * m_resolution[1] * m_resolution[2];
+    m_distances.assign(count, static_cast<float>(m_band));
+    std::vector<char> known(count, 0);
+    const Mat3 toLocal = rotation.transpose();
+
+    #pragma omp parallel
+    {
+        std::vector<int> candidates;
+
+        #pragma omp for schedule(static)
+        for (int k = 0; k < count; ++k) {
+            const int x = k % m_resolution[0];
+            const int y = (k / m_resolution[0]) % m_resolution[1];
+            const int z = k / (m_resolution[0] * m_resolution[1]);
+            const Vec3 world = m_origin + Vec3(x, y, z) * cellSize;
+
+            Scalar distance;
+            if (mesh.signedDistance(toLocal * (world - translation), m_band, candidates, distance)) {
+                m_distances[k] = static_cast<float>(distance);
+                known[k] = 1;
+            }
+        }
+    }
+
+    // A path between samples on opposite sides has to cross the band, so everything the
+    // border reaches without entering it is outside and the rest is inside.
+    std::vector<int> queue;
+    std::vector<char> outside(count, 0);
+    for (int k = 0; k < count; ++k) {
+        const int x = k % m_resolution[0];
+        const int y = (k / m_resolution[0]) % m_resolution[1];
+        const int z = k / (m_resolution[0] * m_resolution[1]);
+        const bool border = x == 0 || y == 0 || z == 0 ||
+                            x == m_resolution[0] - 1 || y == m_resolution[1] - 1 || z == m_resolution[2] - 1;
+        if (border && !known[k]) {
+            outside[k] = 1;
+            queue.push_back(k);
+        }
+    }
+
+    const int strides[3] = { 1, m_resolution[0], m_resolution[0] * m_resolution[1] };
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const int k = queue[head];
+        const int coords[3] = { k % m_resolution[0], (k / m_resolution[0]) % m_resolution[1], k / strides[2] };
+        for (int axis = 0; axis < 3; ++axis) {
+            for (int step : { -1, 1 }) {
+                const int c = coords[axis] + step;
+                if (c < 0 || c >= m_resolution[axis]) continue;
+                const int next = k + step * strides[axis];
+                if (known[next] || outside[next]) continue;
+                outside[next] = 1;
+                queue.push_back(next);
+            }
+        }
+    }
+
+    for (int k = 0; k < count; ++k) {
+        if (!known[k] && !outside[k])
+            m_distances[k] = static_cast<float>(-m_band);
+    }
+}
+
+std::unique_ptr<SDFCollider> SDFCollider::fromOBJ(const std::string& path, Scalar cellSize, int bandCells, Scalar friction) {
+    std::unique_ptr<MeshCollider> mesh = MeshCollider::fromOBJ(path, friction);
+    if (!mesh) return nullptr;
+    return std::make_unique<SDFCollider>(*mesh, cellSize, bandCells, friction);
+}
+
+bool SDFCollider::save(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    const std::int32_t resolution[3] = { m_resolution[0], m_resolution[1], m_resolution[2] };
+    const double header[5] = { static_cast<double>(m_origin.x()), static_cast<double>(m_origin.y()),
+                               static_cast<double>(m_origin.z()), static_cast<double>(m_cellSize),
+                               static_cast<double>(m_band) };
+
+    file.write(CacheMagic, sizeof(CacheMagic));
+    file.write(reinterpret_cast<const char*>(&CacheVersion), sizeof(CacheVersion));
+    file.write(reinterpret_cast<const char*>(resolution), sizeof(resolution));
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_distances.data()), m_distances.size() * sizeof(float));
+    return static_cast<bool>(file);
+}
+
+std::unique_ptr<SDFCollider> SDFCollider::load(const std::string& path, Scalar friction) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return nullptr;
+
+    char magic[4];
+    std::int32_t version = 0;
+    std::int32_t resolution[3];
+    double header[5];
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(resolution), sizeof(resolution));
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!file || std::memcmp(magic, CacheMagic, sizeof(magic)) != 0 || version != CacheVersion ||
+        resolution[0] < 2 || resolution[1] < 2 || resolution[2] < 2 || !(header[3] > 0) || !(header[4] >= 0)) {
+        Logger::warn("SDFCollider: " + path + " is not a distance grid cache");
+        return nullptr;
+    }
+    const size_t count = static_cast<size_t>(resolution[0]) * resolution[1] * resolution[2];
+    if (count > MaxSamples) {
+        Logger::warn("SDFCollider: " + path + " has more than " + std::to_string(MaxSamples) + " samples");
+        return nullptr;
+    }
+
+    std::unique_ptr<SDFCollider> collider(new SDFCollider());
+    collider->m_friction = friction;
+    collider->m_origin = Vec3(header[0], header[1], header[2]);
+    collider->m_cellSize = static_cast<Scalar>(header[3]);
+    collider->m_band = static_cast<Scalar>(header[4]);
+    for (int axis = 0; axis < 3; ++axis)
+        collider->m_resolution[axis] = resolution[axis];
+
+    collider->m_distances.resize(count);
+    file.read(reinterpret_cast<char*>(collider->m_distances.data()), collider->m_distances.size() * sizeof(float));
+    if (!file) {
+        Logger::warn("SDFCollider: " + path + " is truncated");
+        return nullptr;
+    }
+    return collider;
+}
+
+Scalar SDFCollider::sample(const Vec3& point, Vec3& outGradient) const {
+    outGradient = Vec3::Zero();
+    if (m_distances.empty()) return m_band;
+
+    const Vec3 grid = (point - m_origin) / m_cellSize;
+    int cell[3];
+    Scalar f[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        if (grid[axis] < 0.0 || grid[axis] > m_resolution[axis] - 1) return m_band;
+        cell[axis] = std::min(static_cast<int>(grid[axis]), m_resolution[axis] - 2);
+        f[axis] = grid[axis] - cell[axis];
+    }
+
+    const int base = index(cell[0], cell[1], cell[2]);
+    const int dy = m_resolution[0];
+    const int dz = m_resolution[0] * m_resolution[1];
+    const Scalar c000 = m_distances[base],          c100 = m_distances[base + 1];
+    const Scalar c010 = m_distances[base + dy],     c110 = m_distances[base + dy + 1];
+    const Scalar c001 = m_distances[base + dz],     c101 = m_distances[base + dz + 1];
+    const Scalar c011 = m_distances[base + dy + dz], c111 = m_distances[base + dy + dz + 1];
+
+    const Scalar gx = 1.0 - f[0], gy = 1.0 - f[1], gz = 1.0 - f[2];
+
+    // Interpolate along x first, then y, then z; the gradient differentiates each stage.
+    const Scalar x00 = gx * c000 + f[0] * c100;
+    const Scalar x10 = gx * c010 + f[0] * c110;
+    const Scalar x01 = gx * c001 + f[0] * c101;
+    const Scalar x11 = gx * c011 + f[0] * c111;
+    const Scalar y0 = gy * x00 + f[1] * x10;
+    const Scalar y1 = gy * x01 + f[1] * x11;
+
+    const Scalar ddx0 = gy * (c100 - c000) + f[1] * (c110 - c010);
+    const Scalar ddx1 = gy * (c101 - c001) + f[1] * (c111 - c011);
+    outGradient = Vec3(gz * ddx0 + f[2] * ddx1,
+                       gz * (x10 - x00) + f[2] * (x11 - x01),
+                       y1 - y0) / m_cellSize;
+
+    return gz * y0 + f[2] * y1;
+}
+
+void SDFCollider::resolveParticle(Vec3& position, Vec3& oldPosition, Scalar thickness) const {
+    Vec3 gradient;
+    Scalar distance = sample(position, gradient);
+    if (distance >= thickness) return;
+
+    const Scalar gradientNorm = gradient.norm();
+    if (gradientNorm < 1e-9) return;
+    Vec3 normal = gradient / gradientNorm;
+
+    Scalar penetration = thickness - distance;
+    position += normal * penetration;
+
+    Vec3 velocity = position - oldPosition;
+    Vec3 newVelocity = frictionVelocity(velocity, normal, Vec3::Zero());
+
+    oldPosition = position - newVelocity;
+}
+
+void SDFCollider::resolve(ParticleStore& particles, Scalar /*dt*/, Scalar thickness) {
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const int count = particles.size();
+
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < count; ++i)
+        resolveParticle(positions[i], oldPositions[i], thickness);
+}
+
+void SDFCollider::resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar /*dt*/, Scalar thickness) {
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const int count = static_cast<int>(candidates.size());
+
+    #pragma omp parallel for schedule(static)
+    for (int k = 0; k < count; ++k)
+        resolveParticle(positions[candidates[k]], oldPositions[candidates[k]], thickness);
+}
+
+bool SDFCollider::getBounds(Vec3& outLower, Vec3& outUpper) const {
+    if (m_distances.empty()) return false;
+
+    outLower = m_origin;
+    outUpper = m_origin + Vec3(m_resolution[0] - 1, m_resolution[1] - 1, m_resolution[2] - 1) * m_cellSize;
+    return true;
+}
+
+}
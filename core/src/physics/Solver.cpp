@@ -5,159 +5,1784 @@
 
 #include "physics/Solver.hpp"
 #include "engine/World.hpp"
-#include "physics/DistanceConstraint.hpp"
-#include "physics/BendingConstraint.hpp"
+#include "engine/Cloth.hpp"
 #include "physics/Collider.hpp"
 #include "physics/Force.hpp"
-#include "physics/PinConstraint.hpp"
+#include "physics/ContinuousCollision.hpp"
+#include "physics/Proximity.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <cmath>
 #include <Eigen/Dense>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <queue>
 
 namespace ClothSDK {
+
+    namespace {
+
+        template<typename T>
+        inline void project(T& constraint, ParticleStore& particles, Scalar dt, ConstraintResidual*) { constraint.solve(particles, dt); }
+
+        // Distance and bending errors make up the residual, the other buckets only follow.
+        inline void project(DistanceConstraint& constraint, ParticleStore& particles, Scalar dt, ConstraintResidual* residual) { constraint.solve(particles, dt, residual); }
+
+        inline void project(BendingConstraint& constraint, ParticleStore& particles, Scalar dt, ConstraintResidual* residual) { constraint.solve(particles, dt, residual); }
+
+        inline void project(std::unique_ptr<Constraint>& constraint, ParticleStore& particles, Scalar dt, ConstraintResidual*) { constraint->solve(particles, dt); }
+
+        template<typename T>
+        inline void resetLambda(T& constraint) { constraint.resetLambda(); }
+
+        template<typename T>
+        const std::vector<T>& joinBuckets(const std::vector<T>& active, const std::vector<T>& sleeping, std::vector<T>& view) {
+            if (sleeping.empty()) return active;
+            view.assign(active.begin(), active.end());
+            view.insert(view.end(), sleeping.begin(), sleeping.end());
+            return view;
+        }
+
+        inline void resetLambda(std::unique_ptr<Constraint>& constraint) { constraint->resetLambda(); }
+
+        template<typename T>
+        inline void remapBucket(std::vector<T>& bucket, const std::vector<int>& newIndex) {
+            for (auto& constraint : bucket) constraint.remapParticles(newIndex);
+        }
+
+        inline void remapBucket(std::vector<std::unique_ptr<Constraint>>& bucket, const std::vector<int>& newIndex) {
+            for (auto& constraint : bucket) constraint->remapParticles(newIndex);
+        }
+
+        /**
+         * Projects one constraint bucket. Built-in buckets hold records of a single concrete
+         * type, so the calls below are resolved statically and inlined; dispatch happens
+         * once per bucket instead of once per constraint.
+         */
+        template<typename T>
+        void projectBucket(std::vector<T>& bucket, const ConstraintBatches& batches, bool colored, ParticleStore& particles, Scalar dt,
+                           ConstraintResidual* residual) {
+            if (!colored) {
+                for (auto& constraint : bucket)
+                    project(constraint, particles, dt, residual);
+                return;
+            }
+
+            for (int b = 0; b < batches.count(); ++b) {
+                const int begin = batches.offsets[b];
+                const int end = batches.offsets[b + 1];
+
+                if (batches.colors[b] == ConstraintColoring::MaxColors) {
+                    for (int c = begin; c < end; ++c)
+                        project(bucket[c], particles, dt, residual);
+                    continue;
+                }
+
+                #pragma omp parallel if (end - begin > 512)
+                {
+                    ConstraintResidual local;
+                    #pragma omp for schedule(static)
+                    for (int c = begin; c < end; ++c)
+                        project(bucket[c], particles, dt, residual ? &local : nullptr);
+
+                    if (residual) {
+                        #pragma omp critical
+                        residual->merge(local);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Verlet prediction of one particle with damping and the uniform forces. Reports the
+         * squared motion over the previous substep and the squared predicted motion.
+         */
+        inline void predictParticle(int i, std::vector<Vec3>& positions, std::vector<Vec3>& oldPositions,
+                                    std::vector<Vec3>& accelerations, const std::vector<Scalar>& inverseMasses,
+                                    const Vec3& uniformForce, Scalar damping, Scalar dtSq,
+                                    Scalar& outMotionSq, Scalar& outPredictSq) {
+            const Vec3 position = positions[i];
+            const Vec3 motion = position - oldPositions[i];
+            outMotionSq = motion.squaredNorm();
+
+            const Scalar w = inverseMasses[i];
+            const Vec3 acceleration = accelerations[i] + uniformForce * w;
+            const Vec3 predicted = w > 0.0 ? Vec3(position + motion * damping + acceleration * dtSq) : position;
+
+            oldPositions[i] = position;
+            positions[i] = predicted;
+            accelerations[i].setZero();
+            outPredictSq = (predicted - position).squaredNorm();
+        }
+
+        template<typename T>
+        inline void particleIds(const T& constraint, std::vector<int>& outIds) { constraint.getParticleIds(outIds); }
+
+        inline void particleIds(const std::unique_ptr<Constraint>& constraint, std::vector<int>& outIds) { constraint->getParticleIds(outIds); }
+
+        /** Moves the constraints matching @p pred from @p from to the end of @p to, keeping their order. */
+        template<typename T, typename Pred>
+        void moveConstraints(std::vector<T>& from, std::vector<T>& to, Pred pred) {
+            auto split = std::stable_partition(from.begin(), from.end(), [&](const T& c) { return !pred(c); });
+            to.insert(to.end(), std::make_move_iterator(split), std::make_move_iterator(from.end()));
+            from.erase(split, from.end());
+        }
+
+        /**
+         * Computes the XPBD correction of a self-collision pair before mass weighting.
+         * Returns false when the particles are not closer than the thickness.
+         */
+        inline bool computeSelfContact(const Vec3& xA, const Vec3& xB, Scalar wSum, Scalar alphaHat, Scalar thickness, Vec3& outCorrection) {
+            if (wSum + alphaHat < 1e-12) return false;
+
+            Vec3 dir = xA - xB;
+            Scalar distSq = dir.squaredNorm();
+            if (distSq <= 0.0 || distSq >= thickness * thickness) return false;
+
+            Scalar dist = std::sqrt(distSq);
+            Scalar deltaLambda = -(dist - thickness) / (wSum + alphaHat);
+            outCorrection = (dir / dist) * deltaLambda;
+            return true;
+        }
+
+        /**
+         * Computes the XPBD correction of a four-particle proximity stencil whose separation
+         * vector is sum(weights[k] * x[ids[k]]). Returns false when it is not below the thickness.
+         */
+        inline bool computeStencilContact(const int* ids, const Scalar* weights, const std::vector<Vec3>& positions,
+                                          const std::vector<Scalar>& inverseMasses, Scalar alphaHat, Scalar thickness,
+                                          Vec3& outCorrection) {
+            Vec3 dir = Vec3::Zero();
+            Scalar wSum = 0.0;
+            for (int k = 0; k < 4; ++k) {
+                dir += positions[ids[k]] * weights[k];
+                wSum += inverseMasses[ids[k]] * weights[k] * weights[k];
+            }
+            if (wSum + alphaHat < 1e-12) return false;
+
+            Scalar distSq = dir.squaredNorm();
+            if (distSq <= 0.0 || distSq >= thickness * thickness) return false;
+
+            Scalar dist = std::sqrt(distSq);
+            Scalar deltaLambda = -(dist - thickness) / (wSum + alphaHat);
+            outCorrection = (dir / dist) * deltaLambda;
+            return true;
+        }
+
+    }
+
     Solver::Solver()
-    : m_substeps(15), m_iterations(2), m_collisionCompliance(1e-9), m_spatialHash(10007, 0.08) {}
+    : m_longRangeAttachments(false), m_attachmentsDirty(true), m_sleepingIslandCount(0), m_sleeping(false),
+      m_islandsDirty(true), m_sleepThreshold(1e-6), m_sleepFrames(30), m_sleepUniformForce(Vec3::Zero()),
+      m_coloringDirty(true), m_adjacencyDirty(true), m_exclusionRings(1), m_spatialHash(10007, 0.08),
+      m_hashRebuildPolicy(HashRebuildPolicy::PerFrame), m_hashRebuildInterval(4), m_hashRebuildFraction(0.25),
+      m_hashDirty(true), m_hashBuildCount(0), m_substepsSinceHashBuild(0),
+      m_hashDisplacement(0.0), m_predictDisplacement(0.0),
+      m_selfCollisionBackend(SelfCollisionBackend::SpatialHash), m_verletSkin(0.01), m_verletThickness(0.0),
+      m_verletDirty(true), m_verletBuildCount(0), m_triangleTopologyDirty(true),
+      m_continuousCollision(false), m_impactCount(0), m_impactTolerance(0.0), m_impactCandidatesDirty(true),
+      m_colliderHash(10007, 1.0), m_colliderBroadPhase(true),
+      m_substeps(15), m_iterations(2), m_collisionCompliance(1e-9),
+      m_damping(0.98), m_uniformForce(Vec3::Zero()), m_acceleration(IterationAcceleration::None),
+      m_overRelaxation(1.5), m_spectralRadius(0.9), m_residualTolerance(0.0), m_minIterations(1),
+      m_adaptiveSubsteps(false), m_minSubsteps(4), m_maxSubsteps(64), m_substepMotionFraction(0.5), m_lastSubstepDt(0.0),
+      m_constraintMode(ConstraintSolveMode::Sequential),
+      m_selfCollisionMode(SelfCollisionMode::Sequential), m_simdLevel(DistanceKernel::detect()) {}
 
-    void Solver::update(World& world, double deltaTime) {
+    void Solver::update(World& world, Scalar deltaTime) {
         if (m_particles.empty()) return;
 
-        m_spatialHash.setCellSize(world.getThickness()); 
-        m_spatialHash.build(m_particles);
+        if (m_adjacencyDirty) {
+            m_adjacency.build(m_particles.size(), m_exclusionRings);
+            m_adjacencyDirty = false;
+            m_verletDirty = true;
+            m_impactCandidatesDirty = true;
+            m_islandsDirty = true;
+        }
+
+        // Islands come first: rebuilding them wakes everything and returns the constraints
+        // set aside for sleeping islands to the solve.
+        if (m_sleeping && m_islandsDirty)
+            buildIslands();
 
-        double substepDt = deltaTime / static_cast<double>(m_substeps);
-        
-        for (int i = 0; i < m_substeps; i++) {
-            step(world, substepDt);
+        if (m_constraintMode == ConstraintSolveMode::Colored && m_coloringDirty)
+            buildConstraintColoring();
+
+        if (m_longRangeAttachments && m_attachmentsDirty)
+            buildAttachments();
+
+        if (m_spatialHash.getCellSize() != world.getThickness()) {
+            m_spatialHash.setCellSize(world.getThickness());
+            m_hashDirty = true;
         }
+        if (m_selfCollisionBackend == SelfCollisionBackend::TriangleBVH || m_continuousCollision)
+            updateTriangleTopology(world);
+        if (m_selfCollisionBackend != SelfCollisionBackend::TriangleBVH &&
+            (m_hashDirty || m_hashRebuildPolicy == HashRebuildPolicy::PerFrame))
+            rebuildSpatialHash();
+
+        m_impactCount = 0;
+
+        const int substeps = m_adaptiveSubsteps ? chooseSubstepCount(deltaTime, world.getThickness()) : m_substeps;
+        const Scalar substepDt = deltaTime / static_cast<Scalar>(substeps);
+        m_frameStats = FrameStats();
+        m_frameStats.substeps = substeps;
+
+        // Velocities are carried as per-substep displacements, so they are rescaled
+        // whenever the adaptive count changes the substep length.
+        if (m_adaptiveSubsteps && m_lastSubstepDt > 0.0 && substepDt != m_lastSubstepDt) {
+            auto& positions = m_particles.getPositions();
+            auto& oldPositions = m_particles.getOldPositions();
+            const Scalar scale = substepDt / m_lastSubstepDt;
+            const int count = m_particles.size();
+            #pragma omp parallel for
+            for (int i = 0; i < count; ++i)
+                oldPositions[i] = positions[i] - (positions[i] - oldPositions[i]) * scale;
+        }
+        m_lastSubstepDt = substepDt;
+
+        const auto& colliders = world.getColliders();
+        for (int i = 0; i < substeps; i++) {
+            // Kinematic colliders are placed at the end of the substep before it runs,
+            // so every projection sees the surface where the substep leaves it.
+            const Scalar alpha = static_cast<Scalar>(i + 1) / static_cast<Scalar>(substeps);
+            for (auto& collider : colliders)
+                collider->setFrameTime(alpha);
+
+            step(world, substepDt, i == 0);
+        }
+
+        for (auto& collider : colliders)
+            collider->endFrame();
+
+        if (m_sleeping)
+            updateSleep(substepDt, world.getThickness());
+
+        measureResidual(m_frameStats.residualMax, m_frameStats.residualRms);
+
+        const auto& positions = m_particles.getPositions();
+        const auto& oldPositions = m_particles.getOldPositions();
+        const int count = m_particles.size();
+        Scalar maxMotionSq = 0.0;
+        #pragma omp parallel for reduction(max: maxMotionSq)
+        for (int i = 0; i < count; ++i)
+            maxMotionSq = std::max(maxMotionSq, (positions[i] - oldPositions[i]).squaredNorm());
+        m_frameStats.maxSpeed = std::sqrt(maxMotionSq) / substepDt;
+        m_frameStats.activeParticles = m_sleepingIslandCount > 0 ? static_cast<int>(m_activeParticles.size()) : count;
+        m_frameStats.sleepingIslands = m_sleepingIslandCount;
     }
 
-    void Solver::step(World& world, double dt) {
+    void Solver::step(World& world, Scalar dt, bool firstSubstep) {
         applyForces(world, dt);
+        if (firstSubstep && m_sleepingIslandCount > 0)
+            wakeOnForces(dt, world.getThickness());
 
         predictPositions(dt);
+        if (m_continuousCollision)
+            m_substepStart.assign(m_particles.getOldPositions().begin(), m_particles.getOldPositions().end());
+
+        ++m_substepsSinceHashBuild;
+        if (m_selfCollisionBackend != SelfCollisionBackend::TriangleBVH && needsHashRebuild())
+            rebuildSpatialHash();
+
+        resetLambdas();
+
+        auto& positions = m_particles.getPositions();
+        const Scalar rhoSq = m_spectralRadius * m_spectralRadius;
+        Scalar omega = 1.0;
+
+        // Over-relaxation with omega 1 is the plain iteration, so it skips the copies.
+        const IterationAcceleration acceleration =
+            m_acceleration == IterationAcceleration::OverRelaxation && m_overRelaxation == 1.0
+                ? IterationAcceleration::None : m_acceleration;
+
+        int iterations = 0;
+        while (iterations < m_iterations) {
+            if (acceleration != IterationAcceleration::None)
+                m_iterateStart.assign(positions.begin(), positions.end());
+
+            // The residual is gathered by the projections themselves, so it describes the
+            // iterate this iteration started from and the exit lags one iteration behind.
+            ConstraintResidual residual;
+            const bool checkResidual = m_residualTolerance > 0.0 && iterations + 1 >= m_minIterations &&
+                                       iterations + 1 < m_iterations;
+            solveConstraints(dt, checkResidual ? &residual : nullptr);
+            ++iterations;
+
+            if (acceleration == IterationAcceleration::OverRelaxation) {
+                relaxIterate(m_iterateStart, m_overRelaxation);
+            } else if (acceleration == IterationAcceleration::Chebyshev) {
+                // x(k+1) = x(k-1) + omega(k+1) * (projected - x(k-1)). The first two
+                // iterations are taken as is: extrapolating from the predicted positions,
+                // before the large first correction, diverges.
+                if (iterations == 3)
+                    omega = 2 / (2 - rhoSq);
+                else if (iterations > 3)
+                    omega = 4 / (4 - rhoSq * omega);
+                if (iterations > 2)
+                    relaxIterate(m_iteratePrevious, omega);
+                m_iteratePrevious.swap(m_iterateStart);
+            }
+
+            if (checkResidual && residual.max < m_residualTolerance)
+                break;
+        }
+        m_frameStats.iterations += iterations;
+
+        if (m_adaptiveSubsteps)
+            m_collisionStart.assign(positions.begin(), positions.end());
+
+        resolveColliders(world, dt);
+
+        solveSelfCollisions(dt, world.getThickness());
+
+        if (m_continuousCollision)
+            solveContinuousCollisions(world.getThickness());
 
-        for (auto& constraint : m_constraints) {
-            constraint->resetLambda();
+        if (m_adaptiveSubsteps) {
+            const int count = m_particles.size();
+            Scalar maxCorrectionSq = 0.0;
+            #pragma omp parallel for reduction(max: maxCorrectionSq)
+            for (int i = 0; i < count; ++i)
+                maxCorrectionSq = std::max(maxCorrectionSq, (positions[i] - m_collisionStart[i]).squaredNorm());
+            m_frameStats.maxPenetration = std::max(m_frameStats.maxPenetration, std::sqrt(maxCorrectionSq));
         }
+    }
+
+    void Solver::relaxIterate(const std::vector<Vec3>& base, Scalar omega) {
+        auto& positions = m_particles.getPositions();
+        const int count = m_particles.size();
+
+        // Immovable particles keep their position in every iterate, so they need no mask.
+        #pragma omp parallel for simd
+        for (int i = 0; i < count; ++i)
+            positions[i] = base[i] + (positions[i] - base[i]) * omega;
+    }
 
-        for (int i = 0; i < m_iterations; i++) {
-            for(auto& constraint : m_constraints) {
-                constraint->solve(m_particles, dt);
+    void Solver::measureResidual(Scalar& maxResidual, Scalar& rmsResidual) const {
+        const auto& inverseMasses = m_particles.getInverseMasses();
+        const int distanceCount = static_cast<int>(m_distanceConstraints.size());
+        const int bendingCount = static_cast<int>(m_bendingConstraints.size());
+
+        // Constraints between immovable particles cannot be corrected and are left out.
+        Scalar maxC = 0.0;
+        Scalar sumSq = 0.0;
+        int counted = 0;
+        #pragma omp parallel
+        {
+            #pragma omp for reduction(max: maxC) reduction(+: sumSq, counted) nowait
+            for (int k = 0; k < distanceCount; ++k) {
+                const DistanceConstraint& c = m_distanceConstraints[k];
+                if (inverseMasses[c.idA] + inverseMasses[c.idB] == 0.0) continue;
+                const Scalar C = c.evaluate(m_particles);
+                maxC = std::max(maxC, std::abs(C));
+                sumSq += C * C;
+                ++counted;
+            }
+
+            #pragma omp for reduction(max: maxC) reduction(+: sumSq, counted)
+            for (int k = 0; k < bendingCount; ++k) {
+                const BendingConstraint& c = m_bendingConstraints[k];
+                if (inverseMasses[c.idA] + inverseMasses[c.idB] + inverseMasses[c.idC] + inverseMasses[c.idD] == 0.0) continue;
+                const Scalar C = c.evaluate(m_particles);
+                maxC = std::max(maxC, std::abs(C));
+                sumSq += C * C;
+                ++counted;
             }
         }
 
+        maxResidual = maxC;
+        rmsResidual = counted > 0 ? std::sqrt(sumSq / counted) : static_cast<Scalar>(0);
+    }
+
+    int Solver::chooseSubstepCount(Scalar deltaTime, Scalar thickness) const {
+        const Scalar allowedMotion = m_substepMotionFraction * thickness;
+        if (allowedMotion <= 0.0)
+            return m_maxSubsteps;
+
+        // Speeds and corrections of the previous frame predict the motion of this one.
+        int count = static_cast<int>(std::ceil(m_frameStats.maxSpeed * deltaTime / allowedMotion));
+        if (m_frameStats.maxPenetration > allowedMotion)
+            count = std::max(count, 2 * m_frameStats.substeps);
+        return std::min(std::max(count, m_minSubsteps), m_maxSubsteps);
+    }
+
+    void Solver::resolveColliders(const World& world, Scalar dt) {
         const auto& colliders = world.getColliders();
-        for (auto& collider : colliders) {
-            collider->resolve(m_particles, dt, world.getThickness());
+        const Scalar thickness = world.getThickness();
+        const int colliderCount = static_cast<int>(colliders.size());
+
+        if (!m_colliderBroadPhase) {
+            for (auto& collider : colliders)
+                collider->resolve(m_particles, dt, thickness);
+            return;
         }
 
-        solveSelfCollisions(dt, world.getThickness());
+        m_colliderBounds.resize(2 * colliderCount);
+        m_colliderBounded.resize(colliderCount);
+        Scalar extentSum = 0.0;
+        int boundedCount = 0;
+        for (int c = 0; c < colliderCount; ++c) {
+            m_colliderBounded[c] = colliders[c]->getBounds(m_colliderBounds[2 * c], m_colliderBounds[2 * c + 1]);
+            if (!m_colliderBounded[c]) continue;
+            extentSum += (m_colliderBounds[2 * c + 1] - m_colliderBounds[2 * c]).maxCoeff();
+            ++boundedCount;
+        }
+
+        // Cells around half the typical collider size keep box queries to a few cells
+        // each. The hash is binned once, before any collider moves a particle.
+        if (boundedCount > 0) {
+            const Scalar cellSize = std::max(static_cast<Scalar>(0.5) * extentSum / boundedCount, 2 * thickness);
+            m_colliderHash.setCellSize(cellSize);
+            m_colliderHash.build(m_particles);
+        }
+
+        const Vec3 pad = Vec3::Constant(thickness);
+        for (int c = 0; c < colliderCount; ++c) {
+            if (!m_colliderBounded[c]) {
+                if (m_sleepingIslandCount > 0)
+                    colliders[c]->resolve(m_particles, m_contactParticles.empty() ? m_activeParticles : m_contactParticles, dt, thickness);
+                else
+                    colliders[c]->resolve(m_particles, dt, thickness);
+                continue;
+            }
+
+            m_colliderHash.queryBox(m_particles, m_colliderBounds[2 * c] - pad, m_colliderBounds[2 * c + 1] + pad, m_colliderCandidates);
+            if (!m_colliderCandidates.empty()) {
+                colliders[c]->resolve(m_particles, m_colliderCandidates, dt, thickness);
+                if (m_sleepingIslandCount > 0)
+                    wakeOnContacts(m_colliderCandidates, thickness);
+            }
+        }
     }
 
-    void Solver::predictPositions(double dt) {
-        #pragma omp parallel for
-        for (auto& particle : m_particles) {
-            particle.integrate(dt);
+    void Solver::predictPositions(Scalar dt) {
+        auto& positions = m_particles.getPositions();
+        auto& oldPositions = m_particles.getOldPositions();
+        auto& accelerations = m_particles.getAccelerations();
+        const auto& inverseMasses = m_particles.getInverseMasses();
+        const int count = m_particles.size();
+        const Vec3 uniformForce = m_uniformForce;
+        const Scalar damping = m_damping;
+        const Scalar dtSq = dt * dt;
+
+        // Largest motion over the previous substep and over this prediction, used by the
+        // displacement-triggered hash rebuild.
+        Scalar maxMotionSq = 0.0;
+        Scalar maxPredictSq = 0.0;
+
+        // Uniform forces are added here rather than in their own pass, and pinned particles
+        // are handled with a select instead of a branch so the loop stays vectorisable.
+        // Sleeping particles stay where they are, so only the active set is visited.
+        if (m_sleepingIslandCount > 0) {
+            const int activeCount = static_cast<int>(m_activeParticles.size());
+            #pragma omp parallel for reduction(max: maxMotionSq, maxPredictSq)
+            for (int k = 0; k < activeCount; ++k) {
+                Scalar motionSq, predictSq;
+                predictParticle(m_activeParticles[k], positions, oldPositions, accelerations, inverseMasses,
+                                uniformForce, damping, dtSq, motionSq, predictSq);
+                maxMotionSq = std::max(maxMotionSq, motionSq);
+                maxPredictSq = std::max(maxPredictSq, predictSq);
+            }
+        } else {
+            #pragma omp parallel for simd reduction(max: maxMotionSq, maxPredictSq)
+            for (int i = 0; i < count; ++i) {
+                Scalar motionSq, predictSq;
+                predictParticle(i, positions, oldPositions, accelerations, inverseMasses,
+                                uniformForce, damping, dtSq, motionSq, predictSq);
+                maxMotionSq = std::max(maxMotionSq, motionSq);
+                maxPredictSq = std::max(maxPredictSq, predictSq);
+            }
         }
+
+        m_hashDisplacement += std::sqrt(maxMotionSq);
+        m_predictDisplacement = std::sqrt(maxPredictSq);
     }
 
     int Solver::addParticle(const Particle& particle) {
-        m_particles.push_back(particle);
-        return static_cast<int>(m_particles.size() - 1);
+        m_adjacencyDirty = true;
+        m_islandsDirty = true;
+        m_hashDirty = true;
+        m_triangleTopologyDirty = true;
+        const int id = m_particles.add(particle);
+        m_externalToInternal.push_back(id);
+        m_internalToExternal.push_back(id);
+        return id;
     }
 
     void Solver::clear() {
         m_particles.clear();
-        m_constraints.clear();
-        m_adjacencies.clear();
+        m_externalToInternal.clear();
+        m_internalToExternal.clear();
+        m_distanceConstraints.clear();
+        m_bendingConstraints.clear();
+        m_pinConstraints.clear();
+        m_contactConstraints.clear();
+        m_customConstraints.clear();
+        m_attachmentConstraints.clear();
+        m_sleepingDistanceConstraints.clear();
+        m_sleepingBendingConstraints.clear();
+        m_sleepingPinConstraints.clear();
+        m_sleepingContactConstraints.clear();
+        m_sleepingCustomConstraints.clear();
+        m_islandAsleep.clear();
+        m_activeParticles.clear();
+        m_sleepingIslandCount = 0;
+        m_islandsDirty = true;
+        m_distanceBatches.clear();
+        m_bendingBatches.clear();
+        m_pinBatches.clear();
+        m_contactBatches.clear();
+        m_customBatches.clear();
+        m_adjacency.clear();
+        m_coloringDirty = true;
+        m_adjacencyDirty = true;
+        m_attachmentsDirty = true;
+        m_hashDirty = true;
+        m_triangleBVH.clear();
+        m_triangleTopologyDirty = true;
     }
 
     const std::vector<Particle>& Solver::getParticles() const {
-        return m_particles;
+        m_particles.toParticles(m_particleView);
+        return m_particleView;
+    }
+
+    const std::vector<DistanceConstraint>& Solver::getDistanceConstraints() const {
+        return joinBuckets(m_distanceConstraints, m_sleepingDistanceConstraints, m_distanceView);
+    }
+
+    const std::vector<BendingConstraint>& Solver::getBendingConstraints() const {
+        return joinBuckets(m_bendingConstraints, m_sleepingBendingConstraints, m_bendingView);
+    }
+
+    const std::vector<PinConstraint>& Solver::getPinConstraints() const {
+        return joinBuckets(m_pinConstraints, m_sleepingPinConstraints, m_pinView);
+    }
+
+    void Solver::addDistanceConstraint(int idA, int idB, Scalar compliance) {
+        Scalar restLength = (m_particles.getPosition(idA) - m_particles.getPosition(idB)).norm();
+        m_distanceConstraints.emplace_back(idA, idB, restLength, compliance);
+        m_coloringDirty = true;
+        m_adjacency.addEdge(idA, idB);
+        m_adjacencyDirty = true;
+        m_attachmentsDirty = true;
+    }
+
+    void Solver::addBendingConstraint(int idA, int idB, int idC, int idD, Scalar restAngle, Scalar compliance) {
+        m_bendingConstraints.emplace_back(idA, idB, idC, idD, restAngle, compliance);
+        m_coloringDirty = true;
+        m_adjacency.addEdge(idA, idC);
+        m_adjacency.addEdge(idB, idC);
+        m_adjacency.addEdge(idA, idD);
+        m_adjacency.addEdge(idB, idD);
+        m_adjacencyDirty = true;
+    }
+
+    void Solver::addPin(int id, const Vec3& pos, Scalar compliance) {
+        m_pinConstraints.emplace_back(id, pos, compliance);
+        m_coloringDirty = true;
+        m_attachmentsDirty = true;
+    }
+
+    void Solver::addContactConstraint(int idA, int idB, Scalar thickness, Scalar compliance) {
+        m_contactConstraints.emplace_back(idA, idB, thickness, compliance);
+        m_coloringDirty = true;
+    }
+
+    void Solver::addConstraint(std::unique_ptr<Constraint> constraint) {
+        m_customConstraints.push_back(std::move(constraint));
+        m_coloringDirty = true;
+    }
+
+    void Solver::addMassToParticle(int id, Scalar mass) {
+        m_particles.addMass(id, mass);
+        m_attachmentsDirty = true;
+    }
+
+    void Solver::solveConstraints(Scalar dt, ConstraintResidual* residual) {
+        const bool colored = m_constraintMode == ConstraintSolveMode::Colored && !m_coloringDirty;
+
+        if (colored)
+            solveDistanceBatches(dt, residual);
+        else
+            projectBucket(m_distanceConstraints, m_distanceBatches, false, m_particles, dt, residual);
+        projectBucket(m_bendingConstraints, m_bendingBatches, colored, m_particles, dt, residual);
+        projectBucket(m_pinConstraints, m_pinBatches, colored, m_particles, dt, nullptr);
+        if (m_longRangeAttachments)
+            solveAttachments();
+        projectBucket(m_contactConstraints, m_contactBatches, colored, m_particles, dt, nullptr);
+        projectBucket(m_customConstraints, m_customBatches, colored, m_particles, dt, nullptr);
+    }
+
+    void Solver::solveDistanceBatches(Scalar dt, ConstraintResidual* residual) {
+        constexpr int BlockSize = 256;
+
+        for (int b = 0; b < m_distanceBatches.count(); ++b) {
+            const int begin = m_distanceBatches.offsets[b];
+            const int end = m_distanceBatches.offsets[b + 1];
+
+            if (m_distanceBatches.colors[b] == ConstraintColoring::MaxColors) {
+                for (int c = begin; c < end; ++c)
+                    m_distanceConstraints[c].solve(m_particles, dt, residual);
+                continue;
+            }
+
+            #pragma omp parallel if (end - begin > 2 * BlockSize)
+            {
+                ConstraintResidual local;
+                #pragma omp for schedule(static)
+                for (int block = begin; block < end; block += BlockSize) {
+                    const int count = std::min(BlockSize, end - block);
+                    DistanceKernel::solveBatch(&m_distanceConstraints[block], count, m_particles, dt, m_simdLevel,
+                                               residual ? &local : nullptr);
+                }
+
+                if (residual) {
+                    #pragma omp critical
+                    residual->merge(local);
+                }
+            }
+        }
+    }
+
+    void Solver::resetLambdas() {
+        for (auto& constraint : m_distanceConstraints) resetLambda(constraint);
+        for (auto& constraint : m_bendingConstraints) resetLambda(constraint);
+        for (auto& constraint : m_pinConstraints) resetLambda(constraint);
+        for (auto& constraint : m_contactConstraints) resetLambda(constraint);
+        for (auto& constraint : m_customConstraints) resetLambda(constraint);
+    }
+
+    void Solver::buildConstraintColoring() {
+        const int particleCount = m_particles.size();
+        ConstraintColoring::sortByColor(m_distanceConstraints, particleCount, m_distanceBatches);
+        ConstraintColoring::sortByColor(m_bendingConstraints, particleCount, m_bendingBatches);
+        ConstraintColoring::sortByColor(m_pinConstraints, particleCount, m_pinBatches);
+        ConstraintColoring::sortByColor(m_contactConstraints, particleCount, m_contactBatches);
+        ConstraintColoring::sortByColor(m_customConstraints, particleCount, m_customBatches);
+        m_coloringDirty = false;
+    }
+
+    void Solver::buildAttachments() {
+        const int count = m_particles.size();
+        const auto& inverseMasses = m_particles.getInverseMasses();
+
+        // Distance constraints as an undirected graph in CSR form, weighted by rest length.
+        std::vector<int> offsets(count + 1, 0);
+        for (const DistanceConstraint& c : m_distanceConstraints) {
+            ++offsets[c.idA + 1];
+            ++offsets[c.idB + 1];
+        }
+        for (int i = 0; i < count; ++i)
+            offsets[i + 1] += offsets[i];
+
+        std::vector<int> neighbors(offsets[count]);
+        std::vector<Scalar> lengths(offsets[count]);
+        std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+        for (const DistanceConstraint& c : m_distanceConstraints) {
+            neighbors[cursor[c.idA]] = c.idB;
+            lengths[cursor[c.idA]++] = c.restLength;
+            neighbors[cursor[c.idB]] = c.idA;
+            lengths[cursor[c.idB]++] = c.restLength;
+        }
+
+        // Multi-source Dijkstra from every pinned or immovable particle.
+        using Entry = std::pair<Scalar, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        std::vector<Scalar> distances(count, std::numeric_limits<Scalar>::infinity());
+        std::vector<int> anchors(count, -1);
+
+        auto addSource = [&](int id) {
+            if (anchors[id] == id) return;
+            distances[id] = 0.0;
+            anchors[id] = id;
+            queue.push({ static_cast<Scalar>(0), id });
+        };
+        for (const PinConstraint& pin : m_pinConstraints)
+            addSource(pin.particleId);
+        for (int i = 0; i < count; ++i)
+            if (inverseMasses[i] == 0.0 && offsets[i + 1] > offsets[i])
+                addSource(i);
+
+        while (!queue.empty()) {
+            const Entry top = queue.top();
+            queue.pop();
+            const int i = top.second;
+            if (top.first > distances[i]) continue;
+
+            for (int k = offsets[i]; k < offsets[i + 1]; ++k) {
+                const int j = neighbors[k];
+                const Scalar candidate = distances[i] + lengths[k];
+                if (candidate < distances[j]) {
+                    distances[j] = candidate;
+                    anchors[j] = anchors[i];
+                    queue.push({ candidate, j });
+                }
+            }
+        }
+
+        m_attachmentConstraints.clear();
+        for (int i = 0; i < count; ++i) {
+            if (anchors[i] < 0 || anchors[i] == i || inverseMasses[i] == 0.0) continue;
+            m_attachmentConstraints.emplace_back(i, anchors[i], distances[i]);
+        }
+        m_attachmentsDirty = false;
+    }
+
+    void Solver::solveAttachments() {
+        const int attachmentCount = static_cast<int>(m_attachmentConstraints.size());
+
+        // Each attachment moves only its own particle and anchors are never attached, so
+        // the projections are independent.
+        #pragma omp parallel for schedule(static) if (attachmentCount > 512)
+        for (int k = 0; k < attachmentCount; ++k)
+            m_attachmentConstraints[k].solve(m_particles);
+    }
+
+    void Solver::setLongRangeAttachments(bool enabled) {
+        m_longRangeAttachments = enabled;
+        m_attachmentsDirty = true;
+        if (!enabled)
+            m_attachmentConstraints.clear();
+    }
+
+    void Solver::buildIslands() {
+        wakeAll();
+
+        // Connected components of the constraint adjacency, labelled by flood fill.
+        const int count = m_particles.size();
+        const auto& offsets = m_adjacency.getOffsets();
+        const auto& neighbors = m_adjacency.getNeighbors();
+        m_particleIslands.assign(count, -1);
+        m_islandParticles.clear();
+        m_islandOffsets.assign(1, 0);
+
+        for (int seed = 0; seed < count; ++seed) {
+            if (m_particleIslands[seed] >= 0) continue;
+
+            const int island = static_cast<int>(m_islandOffsets.size()) - 1;
+            size_t head = m_islandParticles.size();
+            m_particleIslands[seed] = island;
+            m_islandParticles.push_back(seed);
+            while (head < m_islandParticles.size()) {
+                const int i = m_islandParticles[head++];
+                for (int k = offsets[i]; k < offsets[i + 1]; ++k) {
+                    const int j = neighbors[k];
+                    if (m_particleIslands[j] >= 0) continue;
+                    m_particleIslands[j] = island;
+                    m_islandParticles.push_back(j);
+                }
+            }
+            m_islandOffsets.push_back(static_cast<int>(m_islandParticles.size()));
+        }
+
+        const int islandCount = static_cast<int>(m_islandOffsets.size()) - 1;
+        m_islandAsleep.assign(islandCount, 0);
+        m_islandWaking.assign(islandCount, 0);
+        m_islandRestFrames.assign(islandCount, 0);
+        m_islandsDirty = false;
+    }
+
+    void Solver::updateSleep(Scalar dt, Scalar thickness) {
+        auto& positions = m_particles.getPositions();
+        const auto& oldPositions = m_particles.getOldPositions();
+        auto& accelerations = m_particles.getAccelerations();
+        const auto& inverseMasses = m_particles.getInverseMasses();
+        const int islandCount = static_cast<int>(m_islandAsleep.size());
+        const Scalar wakeDistance = static_cast<Scalar>(0.01) * thickness;
+        const Scalar wakeDistanceSq = wakeDistance * wakeDistance;
+        const Scalar invDtSq = 1 / (dt * dt);
+
+        #pragma omp parallel for schedule(dynamic, 16)
+        for (int island = 0; island < islandCount; ++island) {
+            const int begin = m_islandOffsets[island];
+            const int end = m_islandOffsets[island + 1];
+
+            // Sleeping particles only move when something else pushes them. Pushes below
+            // the wake distance, such as resting contacts, are undone.
+            if (m_islandAsleep[island]) {
+                bool disturbed = false;
+                for (int k = begin; k < end; ++k) {
+                    const int i = m_islandParticles[k];
+                    accelerations[i].setZero();
+                    disturbed |= (positions[i] - oldPositions[i]).squaredNorm() > wakeDistanceSq;
+                }
+                if (disturbed) {
+                    m_islandWaking[island] = 1;
+                } else {
+                    for (int k = begin; k < end; ++k)
+                        positions[m_islandParticles[k]] = oldPositions[m_islandParticles[k]];
+                }
+                continue;
+            }
+
+            Scalar energy = 0.0;
+            int movable = 0;
+            for (int k = begin; k < end; ++k) {
+                const int i = m_islandParticles[k];
+                const Scalar w = inverseMasses[i];
+                if (w == 0.0) continue;
+                energy += static_cast<Scalar>(0.5) * (positions[i] - oldPositions[i]).squaredNorm() * invDtSq / w;
+                ++movable;
+            }
+
+            if (energy <= m_sleepThreshold * movable)
+                ++m_islandRestFrames[island];
+            else
+                m_islandRestFrames[island] = 0;
+        }
+
+        m_sleepUniformForce = m_uniformForce;
+        applySleepStates();
+    }
+
+    void Solver::wakeOnForces(Scalar dt, Scalar thickness) {
+        auto& accelerations = m_particles.getAccelerations();
+        const int islandCount = static_cast<int>(m_islandAsleep.size());
+        const Scalar wakeDistance = static_cast<Scalar>(0.01) * thickness;
+        const Scalar wakeDistanceSq = wakeDistance * wakeDistance;
+        const Scalar dtSq = dt * dt;
+        const bool uniformChanged = m_uniformForce != m_sleepUniformForce;
+
+        // Forces on sleeping particles are dropped unless they would move one noticeably
+        // within a substep; the uniform forces are the ones the islands came to rest under.
+        #pragma omp parallel for schedule(dynamic, 16)
+        for (int island = 0; island < islandCount; ++island) {
+            if (!m_islandAsleep[island]) continue;
+
+            const int begin = m_islandOffsets[island];
+            const int end = m_islandOffsets[island + 1];
+            bool pushed = uniformChanged;
+            for (int k = begin; k < end && !pushed; ++k)
+                pushed = (accelerations[m_islandParticles[k]] * dtSq).squaredNorm() > wakeDistanceSq;
+
+            if (pushed) {
+                m_islandWaking[island] = 1;
+            } else {
+                for (int k = begin; k < end; ++k)
+                    accelerations[m_islandParticles[k]].setZero();
+            }
+        }
+
+        applySleepStates();
+    }
+
+    void Solver::wakeOnContacts(const std::vector<int>& candidates, Scalar thickness) {
+        const auto& positions = m_particles.getPositions();
+        const auto& oldPositions = m_particles.getOldPositions();
+        const Scalar wakeDistance = static_cast<Scalar>(0.01) * thickness;
+        const Scalar wakeDistanceSq = wakeDistance * wakeDistance;
+
+        // Sleeping particles are not predicted, so any motion came from the collider. Their
+        // islands wake at the end of the frame; until then the unbounded colliders see them
+        // along with the active particles, so a push cannot drive them through a floor.
+        for (int i : candidates) {
+            const int island = m_particleIslands[i];
+            if (!m_islandAsleep[island] || m_islandWaking[island]) continue;
+            if ((positions[i] - oldPositions[i]).squaredNorm() <= wakeDistanceSq) continue;
+
+            m_islandWaking[island] = 1;
+            if (m_contactParticles.empty())
+                m_contactParticles = m_activeParticles;
+            m_contactParticles.insert(m_contactParticles.end(), m_islandParticles.begin() + m_islandOffsets[island],
+                                      m_islandParticles.begin() + m_islandOffsets[island + 1]);
+        }
+    }
+
+    void Solver::applySleepStates() {
+        auto& positions = m_particles.getPositions();
+        auto& oldPositions = m_particles.getOldPositions();
+        const int islandCount = static_cast<int>(m_islandAsleep.size());
+
+        m_contactParticles.clear();
+        bool changed = false;
+        for (int island = 0; island < islandCount; ++island) {
+            if (m_islandAsleep[island] && m_islandWaking[island]) {
+                m_islandAsleep[island] = 0;
+                m_islandRestFrames[island] = 0;
+                --m_sleepingIslandCount;
+                changed = true;
+            } else if (!m_islandAsleep[island] && m_islandRestFrames[island] >= m_sleepFrames) {
+                for (int k = m_islandOffsets[island]; k < m_islandOffsets[island + 1]; ++k)
+                    oldPositions[m_islandParticles[k]] = positions[m_islandParticles[k]];
+                m_islandAsleep[island] = 1;
+                ++m_sleepingIslandCount;
+                changed = true;
+            }
+            m_islandWaking[island] = 0;
+        }
+        if (!changed) return;
+
+        m_activeParticles.clear();
+        for (int i = 0; i < m_particles.size(); ++i)
+            if (!m_islandAsleep[m_particleIslands[i]])
+                m_activeParticles.push_back(i);
+
+        // Constraints only leave the solve once all of their particles sleep, so a contact
+        // between a sleeping and an awake island keeps acting and can wake the former. An
+        // empty footprint means the constraint may touch any particle, so it never sleeps.
+        std::vector<int> ids;
+        auto allAsleep = [&](const auto& constraint) {
+            ids.clear();
+            particleIds(constraint, ids);
+            if (ids.empty()) return false;
+            for (int id : ids)
+                if (!m_islandAsleep[m_particleIslands[id]]) return false;
+            return true;
+        };
+        auto anyAwake = [&](const auto& constraint) { return !allAsleep(constraint); };
+
+        moveConstraints(m_sleepingDistanceConstraints, m_distanceConstraints, anyAwake);
+        moveConstraints(m_sleepingBendingConstraints, m_bendingConstraints, anyAwake);
+        moveConstraints(m_sleepingPinConstraints, m_pinConstraints, anyAwake);
+        moveConstraints(m_sleepingContactConstraints, m_contactConstraints, anyAwake);
+        moveConstraints(m_sleepingCustomConstraints, m_customConstraints, anyAwake);
+        moveConstraints(m_distanceConstraints, m_sleepingDistanceConstraints, allAsleep);
+        moveConstraints(m_bendingConstraints, m_sleepingBendingConstraints, allAsleep);
+        moveConstraints(m_pinConstraints, m_sleepingPinConstraints, allAsleep);
+        moveConstraints(m_contactConstraints, m_sleepingContactConstraints, allAsleep);
+        moveConstraints(m_customConstraints, m_sleepingCustomConstraints, allAsleep);
+
+        m_coloringDirty = true;
+        if (m_constraintMode == ConstraintSolveMode::Colored)
+            buildConstraintColoring();
+        m_attachmentsDirty = true;
+        if (m_longRangeAttachments)
+            buildAttachments();
     }
 
-    void Solver::addDistanceConstraint(int idA, int idB, double compliance) {
-        Particle& pA = m_particles[idA];
-        Particle& pB = m_particles[idB];
-        double restLength = (pA.getPosition() - pB.getPosition()).norm();
-        m_constraints.push_back(std::make_unique<DistanceConstraint>(idA, idB, restLength, compliance));
-        m_adjacencies.insert(getAdjacencyKey(idA, idB));
+    void Solver::wakeAll() {
+        if (m_sleepingIslandCount == 0) return;
+
+        auto all = [](const auto&) { return true; };
+        moveConstraints(m_sleepingDistanceConstraints, m_distanceConstraints, all);
+        moveConstraints(m_sleepingBendingConstraints, m_bendingConstraints, all);
+        moveConstraints(m_sleepingPinConstraints, m_pinConstraints, all);
+        moveConstraints(m_sleepingContactConstraints, m_contactConstraints, all);
+        moveConstraints(m_sleepingCustomConstraints, m_customConstraints, all);
+
+        std::fill(m_islandAsleep.begin(), m_islandAsleep.end(), 0);
+        std::fill(m_islandWaking.begin(), m_islandWaking.end(), 0);
+        std::fill(m_islandRestFrames.begin(), m_islandRestFrames.end(), 0);
+        m_activeParticles.clear();
+        m_contactParticles.clear();
+        m_sleepingIslandCount = 0;
+        m_coloringDirty = true;
+        m_attachmentsDirty = true;
     }
 
-    void Solver::addBendingConstraint(int idA, int idB, int idC, int idD, double restAngle, double compliance) {
-        m_constraints.push_back(std::make_unique<BendingConstraint>(idA, idB, idC, idD, restAngle, compliance));
-        m_adjacencies.insert(getAdjacencyKey(idA, idC));
-        m_adjacencies.insert(getAdjacencyKey(idB, idC));
-        m_adjacencies.insert(getAdjacencyKey(idA, idD));
-        m_adjacencies.insert(getAdjacencyKey(idB, idD));
+    void Solver::setSleeping(bool enabled) {
+        if (!enabled)
+            wakeAll();
+        m_sleeping = enabled;
+        m_islandsDirty = true;
     }
 
-    void Solver::addPin(int id, const Eigen::Vector3d& pos, double compliance) {
-        m_constraints.push_back(std::make_unique<PinConstraint>(id, pos, compliance));
+    void Solver::setSleepFrames(int frames) {
+        m_sleepFrames = std::max(frames, 1);
     }
 
-    void Solver::addMassToParticle(int id, double mass) {
-        Particle& pA = m_particles[id];
-        pA.addMass(mass);
+    int Solver::getConstraintBatchCount() const {
+        return m_distanceBatches.count() + m_bendingBatches.count() + m_pinBatches.count()
+             + m_contactBatches.count() + m_customBatches.count();
     }
 
-    void Solver::solveConstraints(double dt) {
-        for(auto& constraint : m_constraints)
-            constraint->solve(m_particles, dt);
+    void Solver::setConstraintSolveMode(ConstraintSolveMode mode) {
+        m_constraintMode = mode;
     }
 
-    void Solver::solveSelfCollisions(double dt, double thickness) {
-        double alphaHat = m_collisionCompliance / (dt * dt);
-        double thicknessSq = thickness * thickness;
+    void Solver::setSimdLevel(SimdLevel level) {
+        if (!DistanceKernel::isSupported(level)) {
+            m_simdLevel = DistanceKernel::detect();
+            Logger::warn(std::string("SIMD level ") + DistanceKernel::toString(level)
+                         + " is not available, using " + DistanceKernel::toString(m_simdLevel));
+            return;
+        }
+        m_simdLevel = level;
+    }
 
-        for (int i = 0; i < (int)m_particles.size(); ++i) {
-            Particle& pA = m_particles[i];
-            double wA = pA.getInverseMass();
+    void Solver::solveSelfCollisions(Scalar dt, Scalar thickness) {
+        if (m_selfCollisionBackend == SelfCollisionBackend::VerletList) {
+            updateVerletList(thickness);
+            solveVerletPairs(dt, thickness);
+        } else if (m_selfCollisionBackend == SelfCollisionBackend::TriangleBVH) {
+            solveTriangleCollisions(dt, thickness);
+        } else if (m_selfCollisionMode == SelfCollisionMode::Parallel) {
+            solveSelfCollisionsParallel(dt, thickness);
+        } else {
+            solveSelfCollisionsSequential(dt, thickness);
+        }
+    }
+
+    void Solver::solveSelfCollisionsSequential(Scalar dt, Scalar thickness) {
+        Scalar alphaHat = m_collisionCompliance / (dt * dt);
+        Scalar thicknessSq = thickness * thickness;
+
+        for (int i = 0; i < m_particles.size(); ++i) {
+            Scalar wA = m_particles.getInverseMass(i);
             if (wA == 0.0) continue;
 
-            m_spatialHash.query(m_particles, pA.getPosition(), thickness, m_neighborsBuffer);
+            m_spatialHash.query(m_particles, m_particles.getPosition(i), thickness, m_neighborsBuffer);
 
             for (int j : m_neighborsBuffer) {
                 if (i >= j) continue; 
 
-                if (m_adjacencies.count(getAdjacencyKey(i, j))) continue;
+                if (m_adjacency.contains(i, j)) continue;
 
-                Particle& pB = m_particles[j];
-                double wB = pB.getInverseMass();
-                double wSum = wA + wB;
+                Scalar wB = m_particles.getInverseMass(j);
+                Scalar wSum = wA + wB;
 
                 if (wSum + alphaHat < 1e-12) continue;
 
-                Eigen::Vector3d dir = pA.getPosition() - pB.getPosition();
-                double distSq = dir.squaredNorm();
+                Vec3 dir = m_particles.getPosition(i) - m_particles.getPosition(j);
+                Scalar distSq = dir.squaredNorm();
 
                 if (distSq > 0.0 && distSq < thicknessSq) {
-                    double dist = std::sqrt(distSq);
-                    Eigen::Vector3d normal = dir / dist;
+                    Scalar dist = std::sqrt(distSq);
+                    Vec3 normal = dir / dist;
 
-                    double C = dist - thickness;
+                    Scalar C = dist - thickness;
                     
-                    double deltaLambda = -C / (wSum + alphaHat);
-                    Eigen::Vector3d corr = normal * deltaLambda;
+                    Scalar deltaLambda = -C / (wSum + alphaHat);
+                    Vec3 corr = normal * deltaLambda;
 
-                    pA.setPosition(pA.getPosition() + corr * wA);
-                    pB.setPosition(pB.getPosition() - corr * wB);
+                    m_particles.setPosition(i, m_particles.getPosition(i) + corr * wA);
+                    m_particles.setPosition(j, m_particles.getPosition(j) - corr * wB);
                 }
             }
         }
     }
 
-    void Solver::applyForces(World& world, double dt) {
+    void Solver::solveSelfCollisionsParallel(Scalar dt, Scalar thickness) {
+        const Scalar alphaHat = m_collisionCompliance / (dt * dt);
+        const int count = m_particles.size();
+        const auto& positions = m_particles.getPositions();
+        const auto& inverseMasses = m_particles.getInverseMasses();
+
+        const int threadCount = omp_get_max_threads();
+        m_threadNeighbors.resize(threadCount);
+        m_threadContacts.resize(threadCount);
+
+        // Detection only reads positions. With a static schedule every thread owns a
+        // contiguous range of particles, so concatenating the per-thread lists in thread
+        // order gives the same contact order for any thread count.
+        #pragma omp parallel num_threads(threadCount)
+        {
+            const int thread = omp_get_thread_num();
+            std::vector<int>& neighbors = m_threadNeighbors[thread];
+            std::vector<SelfContact>& contacts = m_threadContacts[thread];
+            contacts.clear();
+
+            #pragma omp for schedule(static)
+            for (int i = 0; i < count; ++i) {
+                const Scalar wA = inverseMasses[i];
+                if (wA == 0.0) continue;
+
+                m_spatialHash.query(m_particles, positions[i], thickness, neighbors);
+
+                for (int j : neighbors) {
+                    if (i >= j) continue;
+                    if (m_adjacency.contains(i, j)) continue;
+
+                    Vec3 correction;
+                    if (computeSelfContact(positions[i], positions[j], wA + inverseMasses[j], alphaHat, thickness, correction))
+                        contacts.push_back({ i, j, correction });
+                }
+            }
+        }
+
+        gatherThreadContacts();
+        applySelfContacts();
+    }
+
+    void Solver::solveVerletPairs(Scalar dt, Scalar thickness) {
+        const Scalar alphaHat = m_collisionCompliance / (dt * dt);
+        const int pairCount = static_cast<int>(m_verletPairs.size());
+        auto& positions = m_particles.getPositions();
+        const auto& inverseMasses = m_particles.getInverseMasses();
+
+        if (m_selfCollisionMode == SelfCollisionMode::Sequential) {
+            for (const SelfCollisionPair& pair : m_verletPairs) {
+                const Scalar wA = inverseMasses[pair.idA];
+                const Scalar wB = inverseMasses[pair.idB];
+
+                Vec3 correction;
+                if (computeSelfContact(positions[pair.idA], positions[pair.idB], wA + wB, alphaHat, thickness, correction)) {
+                    positions[pair.idA] += correction * wA;
+                    positions[pair.idB] -= correction * wB;
+                }
+            }
+            return;
+        }
+
+        const int threadCount = omp_get_max_threads();
+        m_threadContacts.resize(threadCount);
+
+        #pragma omp parallel num_threads(threadCount)
+        {
+            std::vector<SelfContact>& contacts = m_threadContacts[omp_get_thread_num()];
+            contacts.clear();
+
+            #pragma omp for schedule(static)
+            for (int k = 0; k < pairCount; ++k) {
+                const SelfCollisionPair& pair = m_verletPairs[k];
+
+                Vec3 correction;
+                if (computeSelfContact(positions[pair.idA], positions[pair.idB],
+                                       inverseMasses[pair.idA] + inverseMasses[pair.idB], alphaHat, thickness, correction))
+                    contacts.push_back({ pair.idA, pair.idB, correction });
+            }
+        }
+
+        gatherThreadContacts();
+        applySelfContacts();
+    }
+
+    void Solver::updateVerletList(Scalar thickness) {
+        const int count = m_particles.size();
+        const auto& positions = m_particles.getPositions();
+
+        if (!m_verletDirty && m_verletThickness == thickness && static_cast<int>(m_verletPositions.size()) == count) {
+            // The list stays complete while no particle has moved more than half the skin.
+            Scalar maxMoveSq = 0.0;
+            #pragma omp parallel for reduction(max: maxMoveSq)
+            for (int i = 0; i < count; ++i)
+                maxMoveSq = std::max(maxMoveSq, (positions[i] - m_verletPositions[i]).squaredNorm());
+
+            const Scalar halfSkin = static_cast<Scalar>(0.5) * m_verletSkin;
+            if (maxMoveSq < halfSkin * halfSkin)
+                return;
+        }
+
+        rebuildSpatialHash();
+
+        const Scalar radius = thickness + m_verletSkin;
+        const auto& inverseMasses = m_particles.getInverseMasses();
+        const int threadCount = omp_get_max_threads();
+        m_threadNeighbors.resize(threadCount);
+        m_threadPairs.resize(threadCount);
+
+        #pragma omp parallel num_threads(threadCount)
+        {
+            const int thread = omp_get_thread_num();
+            std::vector<int>& neighbors = m_threadNeighbors[thread];
+            std::vector<SelfCollisionPair>& pairs = m_threadPairs[thread];
+            pairs.clear();
+
+            #pragma omp for schedule(static)
+            for (int i = 0; i < count; ++i) {
+                if (inverseMasses[i] == 0.0) continue;
+
+                m_spatialHash.query(m_particles, positions[i], radius, neighbors);
+                std::sort(neighbors.begin(), neighbors.end());
+
+                int previous = -1;
+                for (int j : neighbors) {
+                    if (j <= i || j == previous) continue;
+                    previous = j;
+                    if (m_adjacency.contains(i, j)) continue;
+                    pairs.push_back({ i, j });
+                }
+            }
+        }
+
+        m_verletPairs.clear();
+        for (const auto& pairs : m_threadPairs)
+            m_verletPairs.insert(m_verletPairs.end(), pairs.begin(), pairs.end());
+
+        m_verletPositions.assign(positions.begin(), positions.end());
+        m_verletThickness = thickness;
+        m_verletDirty = false;
+        m_verletBuildCount++;
+    }
+
+    void Solver::gatherThreadContacts() {
+        m_selfContacts.clear();
+        for (const auto& contacts : m_threadContacts)
+            m_selfContacts.insert(m_selfContacts.end(), contacts.begin(), contacts.end());
+    }
+
+    void Solver::applySelfContacts() {
+        if (m_selfContacts.empty()) return;
+
+        const int count = m_particles.size();
+        auto& positions = m_particles.getPositions();
+        const auto& inverseMasses = m_particles.getInverseMasses();
+
+        // Bucket the contacts by particle so every particle can gather its own corrections.
+        const int contactCount = static_cast<int>(m_selfContacts.size());
+        m_selfContactOffsets.assign(count + 1, 0);
+        for (const SelfContact& contact : m_selfContacts) {
+            m_selfContactOffsets[contact.idA + 1]++;
+            m_selfContactOffsets[contact.idB + 1]++;
+        }
+        for (int i = 0; i < count; ++i)
+            m_selfContactOffsets[i + 1] += m_selfContactOffsets[i];
+
+        m_selfContactRefs.resize(2 * contactCount);
+        std::vector<int> cursor(m_selfContactOffsets.begin(), m_selfContactOffsets.end() - 1);
+        for (int k = 0; k < contactCount; ++k) {
+            m_selfContactRefs[cursor[m_selfContacts[k].idA]++] = 2 * k;
+            m_selfContactRefs[cursor[m_selfContacts[k].idB]++] = 2 * k + 1;
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < count; ++i) {
+            const int begin = m_selfContactOffsets[i];
+            const int end = m_selfContactOffsets[i + 1];
+            if (begin == end || inverseMasses[i] == 0.0) continue;
+
+            Vec3 delta = Vec3::Zero();
+            for (int r = begin; r < end; ++r) {
+                const int ref = m_selfContactRefs[r];
+                const Vec3& correction = m_selfContacts[ref >> 1].correction;
+                if (ref & 1)
+                    delta -= correction;
+                else
+                    delta += correction;
+            }
+
+            positions[i] += delta * (inverseMasses[i] / static_cast<Scalar>(end - begin));
+        }
+    }
+
+    void Solver::reorderParticles(World& world, ParticleOrderingMethod method) {
+        const int count = m_particles.size();
+        if (count == 0) return;
+
+        // Islands are rebuilt after the permutation; constraints set aside must follow it too.
+        wakeAll();
+
+        std::vector<int> order;
+        if (method == ParticleOrderingMethod::Morton) {
+            ParticleOrdering::mortonOrder(m_particles.getPositions(), order);
+        } else {
+            ParticleAdjacency graph = m_adjacency;
+            graph.build(count, 1);
+            ParticleOrdering::reverseCuthillMcKee(graph.getOffsets(), graph.getNeighbors(), order);
+        }
+
+        std::vector<int> newIndex;
+        ParticleOrdering::invert(order, newIndex);
+
+        m_particles.permute(order);
+        remapBucket(m_distanceConstraints, newIndex);
+        remapBucket(m_bendingConstraints, newIndex);
+        remapBucket(m_pinConstraints, newIndex);
+        remapBucket(m_attachmentConstraints, newIndex);
+        remapBucket(m_contactConstraints, newIndex);
+        remapBucket(m_customConstraints, newIndex);
+        m_adjacency.remap(newIndex);
+
+        for (auto& cloth : world.getCloths())
+            cloth->remapParticles(newIndex);
+        for (auto& force : world.getForces())
+            force->remapParticles(newIndex);
+
+        std::vector<int> internalToExternal(count);
+        for (int k = 0; k < count; ++k)
+            internalToExternal[k] = m_internalToExternal[order[k]];
+        m_internalToExternal.swap(internalToExternal);
+        for (int& id : m_externalToInternal)
+            id = newIndex[id];
+
+        m_coloringDirty = true;
+        m_adjacencyDirty = true;
+        m_hashDirty = true;
+        m_verletDirty = true;
+        m_triangleTopologyDirty = true;
+        m_impactCandidatesDirty = true;
+    }
+
+    void Solver::updateTriangleTopology(const World& world) {
+        int triangleCount = 0;
+        for (const auto& cloth : world.getCloths())
+            triangleCount += static_cast<int>(cloth->getTriangles().size());
+        if (!m_triangleTopologyDirty && triangleCount == m_triangleBVH.getTriangleCount())
+            return;
+
+        std::vector<Triangle> triangles;
+        triangles.reserve(triangleCount);
+        for (const auto& cloth : world.getCloths())
+            triangles.insert(triangles.end(), cloth->getTriangles().begin(), cloth->getTriangles().end());
+        m_triangleBVH.build(triangles, m_particles.getPositions());
+
+        // Number the unique edges; each triangle slot points at its edge.
+        std::vector<std::pair<SelfCollisionPair, int>> slots;
+        slots.reserve(3 * triangleCount);
+        for (int t = 0; t < triangleCount; ++t) {
+            const Triangle& tri = triangles[t];
+            const int ids[3] = { tri.a, tri.b, tri.c };
+            for (int k = 0; k < 3; ++k) {
+                const int a = ids[k];
+                const int b = ids[(k + 1) % 3];
+                slots.push_back({ { std::min(a, b), std::max(a, b) }, 3 * t + k });
+            }
+        }
+        std::sort(slots.begin(), slots.end(), [](const auto& lhs, const auto& rhs) {
+            if (lhs.first.idA != rhs.first.idA) return lhs.first.idA < rhs.first.idA;
+            if (lhs.first.idB != rhs.first.idB) return lhs.first.idB < rhs.first.idB;
+            return lhs.second < rhs.second;
+        });
+
+        m_meshEdges.clear();
+        m_edgeOwners.clear();
+        m_triangleEdges.assign(3 * triangleCount, -1);
+        for (const auto& slot : slots) {
+            if (m_meshEdges.empty() || m_meshEdges.back().idA != slot.first.idA || m_meshEdges.back().idB != slot.first.idB) {
+                m_meshEdges.push_back(slot.first);
+                m_edgeOwners.push_back(slot.second / 3);
+            }
+            m_triangleEdges[slot.second] = static_cast<int>(m_meshEdges.size()) - 1;
+        }
+
+        m_triangleTopologyDirty = false;
+        m_impactCandidatesDirty = true;
+    }
+
+    void Solver::solveTriangleCollisions(Scalar dt, Scalar thickness) {
+        if (m_triangleBVH.empty()) return;
+
+        const Scalar alphaHat = m_collisionCompliance / (dt * dt);
+        const int count = m_particles.size();
+        const int edgeCount = static_cast<int>(m_meshEdges.size());
+        auto& positions = m_particles.getPositions();
+        const auto& inverseMasses = m_particles.getInverseMasses();
+        const auto& triangles = m_triangleBVH.getTriangles();
+        const Vec3 pad = Vec3::Constant(thickness);
+
+        m_triangleBVH.refit(positions);
+
+        auto excluded = [this](int a, int b) { return isTopologicallyClose(a, b); };
+        auto disjoint = [](const Vec3& lowerA, const Vec3& upperA, const Vec3& lowerB, const Vec3& upperB) {
+            return (upperA.array() < lowerB.array()).any() || (lowerA.array() > upperB.array()).any();
+        };
+
+        // Vertex against every nearby triangle that is not topologically close to it.
+        auto detectVertex = [&](int i, std::vector<int>& candidates, auto&& emit) {
+            const Vec3 lower = positions[i] - pad;
+            const Vec3 upper = positions[i] + pad;
+            m_triangleBVH.query(lower, upper, candidates);
+            for (int t : candidates) {
+                const Triangle& tri = triangles[t];
+                const Vec3& xa = positions[tri.a];
+                const Vec3& xb = positions[tri.b];
+                const Vec3& xc = positions[tri.c];
+                if (disjoint(xa.cwiseMin(xb).cwiseMin(xc), xa.cwiseMax(xb).cwiseMax(xc), lower, upper)) continue;
+                if (excluded(i, tri.a) || excluded(i, tri.b) || excluded(i, tri.c)) continue;
+
+                Vec3 bary;
+                Proximity::closestPointOnTriangle(positions[i], xa, xb, xc, bary);
+                TriangleContact contact = { { i, tri.a, tri.b, tri.c }, { 1.0, -bary.x(), -bary.y(), -bary.z() }, Vec3::Zero() };
+                if (computeStencilContact(contact.ids, contact.weights, positions, inverseMasses, alphaHat, thickness, contact.correction))
+                    emit(contact);
+            }
+        };
+
+        // Edge against the edges of nearby triangles. Contacts at an endpoint are left to
+        // the vertex-triangle test, so only interior crossings are handled here.
+        auto detectEdge = [&](int e, std::vector<int>& candidates, auto&& emit) {
+            const SelfCollisionPair& edge = m_meshEdges[e];
+            const Vec3& a = positions[edge.idA];
+            const Vec3& b = positions[edge.idB];
+            const Vec3 lower = a.cwiseMin(b) - pad;
+            const Vec3 upper = a.cwiseMax(b) + pad;
+            m_triangleBVH.query(lower, upper, candidates);
+
+            for (int tri : candidates) {
+                for (int k = 0; k < 3; ++k) {
+                    const int o = m_triangleEdges[3 * tri + k];
+                    if (o <= e || m_edgeOwners[o] != tri) continue;
+
+                    const SelfCollisionPair& otherEdge = m_meshEdges[o];
+                    const Vec3& c = positions[otherEdge.idA];
+                    const Vec3& d = positions[otherEdge.idB];
+                    if (disjoint(c.cwiseMin(d), c.cwiseMax(d), lower, upper)) continue;
+                    if (excluded(edge.idA, otherEdge.idA) || excluded(edge.idA, otherEdge.idB) ||
+                        excluded(edge.idB, otherEdge.idA) || excluded(edge.idB, otherEdge.idB)) continue;
+
+                    Scalar s, t;
+                    Scalar distSq = Proximity::closestPointsOnSegments(a, b, c, d, s, t);
+                    if (distSq >= thickness * thickness || s <= 0.0 || s >= 1.0 || t <= 0.0 || t >= 1.0) continue;
+
+                    TriangleContact contact = { { edge.idA, edge.idB, otherEdge.idA, otherEdge.idB },
+                                                { 1 - s, s, t - 1, -t }, Vec3::Zero() };
+                    if (computeStencilContact(contact.ids, contact.weights, positions, inverseMasses, alphaHat, thickness, contact.correction))
+                        emit(contact);
+                }
+            }
+        };
+
+        const int threadCount = omp_get_max_threads();
+        m_threadNeighbors.resize(threadCount);
+        m_threadTriangleContacts.resize(2 * threadCount);
+
+        if (m_selfCollisionMode == SelfCollisionMode::Sequential) {
+            auto apply = [&](const TriangleContact& contact) {
+                for (int k = 0; k < 4; ++k)
+                    positions[contact.ids[k]] += contact.correction * (inverseMasses[contact.ids[k]] * contact.weights[k]);
+            };
+            for (int i = 0; i < count; ++i)
+                detectVertex(i, m_threadNeighbors[0], apply);
+            for (int e = 0; e < edgeCount; ++e)
+                detectEdge(e, m_threadNeighbors[0], apply);
+            return;
+        }
+
+        // Same scheme as the parallel point pass: static ranges, per-thread lists joined in
+        // thread order, then a per-particle average of the corrections. Vertex and edge
+        // contacts get separate lists so the joined order does not depend on the thread count.
+        #pragma omp parallel num_threads(threadCount)
+        {
+            const int thread = omp_get_thread_num();
+            std::vector<int>& candidates = m_threadNeighbors[thread];
+            std::vector<TriangleContact>& vertexContacts = m_threadTriangleContacts[thread];
+            std::vector<TriangleContact>& edgeContacts = m_threadTriangleContacts[threadCount + thread];
+            vertexContacts.clear();
+            edgeContacts.clear();
+
+            #pragma omp for schedule(static) nowait
+            for (int i = 0; i < count; ++i)
+                detectVertex(i, candidates, [&vertexContacts](const TriangleContact& contact) { vertexContacts.push_back(contact); });
+
+            #pragma omp for schedule(static)
+            for (int e = 0; e < edgeCount; ++e)
+                detectEdge(e, candidates, [&edgeContacts](const TriangleContact& contact) { edgeContacts.push_back(contact); });
+        }
+
+        m_triangleContacts.clear();
+        for (const auto& contacts : m_threadTriangleContacts)
+            m_triangleContacts.insert(m_triangleContacts.end(), contacts.begin(), contacts.end());
+        applyTriangleContacts();
+    }
+
+    void Solver::updateImpactCandidates(Scalar tolerance) {
+        const int count = m_particles.size();
+        const auto& positions = m_particles.getPositions();
+        const std::vector<Vec3>& start = m_substepStart;
+
+        if (!m_impactCandidatesDirty && m_impactTolerance == tolerance && static_cast<int>(m_impactPositions.size()) == count) {
+            // Pairs only depend on relative motion, so both ends of every trajectory must stay
+            // within half the skin of the build positions shifted by a common translation.
+            // The centres of the displacement bounds are used as the translations.
+            // Slots 0-2 bound the start displacements, 3-5 the end displacements.
+            Scalar upper[6], negLower[6];
+            for (int k = 0; k < 6; ++k)
+                upper[k] = negLower[k] = std::numeric_limits<Scalar>::lowest();
+            #pragma omp parallel for reduction(max: upper[:6], negLower[:6])
+            for (int i = 0; i < count; ++i) {
+                const Vec3 startMove = start[i] - m_impactPositions[i];
+                const Vec3 endMove = positions[i] - m_impactPositions[i];
+                for (int axis = 0; axis < 3; ++axis) {
+                    upper[axis] = std::max(upper[axis], startMove[axis]);
+                    negLower[axis] = std::max(negLower[axis], -startMove[axis]);
+                    upper[3 + axis] = std::max(upper[3 + axis], endMove[axis]);
+                    negLower[3 + axis] = std::max(negLower[3 + axis], -endMove[axis]);
+                }
+            }
+            const Vec3 startShift = static_cast<Scalar>(0.5) * Vec3(upper[0] - negLower[0], upper[1] - negLower[1], upper[2] - negLower[2]);
+            const Vec3 endShift = static_cast<Scalar>(0.5) * Vec3(upper[3] - negLower[3], upper[4] - negLower[4], upper[5] - negLower[5]);
+
+            Scalar maxMoveSq = 0.0;
+            #pragma omp parallel for reduction(max: maxMoveSq)
+            for (int i = 0; i < count; ++i) {
+                maxMoveSq = std::max(maxMoveSq, (start[i] - m_impactPositions[i] - startShift).squaredNorm());
+                maxMoveSq = std::max(maxMoveSq, (positions[i] - m_impactPositions[i] - endShift).squaredNorm());
+            }
+
+            const Scalar halfSkin = static_cast<Scalar>(0.5) * m_verletSkin;
+            if (maxMoveSq < halfSkin * halfSkin)
+                return;
+        }
+
+        // Candidates come from the boxes swept over this substep padded by the skin, which
+        // also bound every later trajectory that stays within half the skin of the end positions.
+        m_triangleBVH.refit(start, positions);
+
+        const int edgeCount = static_cast<int>(m_meshEdges.size());
+        const auto& triangles = m_triangleBVH.getTriangles();
+        const Vec3 pad = Vec3::Constant(m_verletSkin + tolerance);
+        auto sweptLower = [&](int id) { return start[id].cwiseMin(positions[id]); };
+        auto sweptUpper = [&](int id) { return start[id].cwiseMax(positions[id]); };
+        auto disjoint = [](const Vec3& lowerA, const Vec3& upperA, const Vec3& lowerB, const Vec3& upperB) {
+            return (upperA.array() < lowerB.array()).any() || (lowerA.array() > upperB.array()).any();
+        };
+        auto triangleLower = [&](const Triangle& tri) { return sweptLower(tri.a).cwiseMin(sweptLower(tri.b)).cwiseMin(sweptLower(tri.c)); };
+        auto triangleUpper = [&](const Triangle& tri) { return sweptUpper(tri.a).cwiseMax(sweptUpper(tri.b)).cwiseMax(sweptUpper(tri.c)); };
+
+        const int threadCount = omp_get_max_threads();
+        m_threadNeighbors.resize(threadCount);
+        m_threadPairs.resize(2 * threadCount);
+
+        #pragma omp parallel num_threads(threadCount)
+        {
+            const int thread = omp_get_thread_num();
+            std::vector<int>& candidates = m_threadNeighbors[thread];
+            std::vector<SelfCollisionPair>& vertexPairs = m_threadPairs[thread];
+            std::vector<SelfCollisionPair>& edgePairs = m_threadPairs[threadCount + thread];
+            vertexPairs.clear();
+            edgePairs.clear();
+
+            #pragma omp for schedule(static) nowait
+            for (int i = 0; i < count; ++i) {
+                const Vec3 lower = sweptLower(i) - pad;
+                const Vec3 upper = sweptUpper(i) + pad;
+                m_triangleBVH.query(lower, upper, candidates);
+
+                for (int t : candidates) {
+                    const Triangle& tri = triangles[t];
+                    if (disjoint(triangleLower(tri), triangleUpper(tri), lower, upper)) continue;
+                    if (isTopologicallyClose(i, tri.a) || isTopologicallyClose(i, tri.b) || isTopologicallyClose(i, tri.c)) continue;
+                    vertexPairs.push_back({ i, t });
+                }
+            }
+
+            #pragma omp for schedule(static)
+            for (int e = 0; e < edgeCount; ++e) {
+                const SelfCollisionPair& edge = m_meshEdges[e];
+                const Vec3 lower = sweptLower(edge.idA).cwiseMin(sweptLower(edge.idB)) - pad;
+                const Vec3 upper = sweptUpper(edge.idA).cwiseMax(sweptUpper(edge.idB)) + pad;
+                m_triangleBVH.query(lower, upper, candidates);
+
+                for (int tri : candidates) {
+                    if (disjoint(triangleLower(triangles[tri]), triangleUpper(triangles[tri]), lower, upper)) continue;
+
+                    for (int k = 0; k < 3; ++k) {
+                        const int o = m_triangleEdges[3 * tri + k];
+                        if (o <= e || m_edgeOwners[o] != tri) continue;
+
+                        const SelfCollisionPair& other = m_meshEdges[o];
+                        if (disjoint(sweptLower(other.idA).cwiseMin(sweptLower(other.idB)),
+                                     sweptUpper(other.idA).cwiseMax(sweptUpper(other.idB)), lower, upper)) continue;
+                        if (isTopologicallyClose(edge.idA, other.idA) || isTopologicallyClose(edge.idA, other.idB) ||
+                            isTopologicallyClose(edge.idB, other.idA) || isTopologicallyClose(edge.idB, other.idB)) continue;
+                        edgePairs.push_back({ e, o });
+                    }
+                }
+            }
+        }
+
+        m_impactVertexPairs.clear();
+        m_impactEdgePairs.clear();
+        for (int thread = 0; thread < threadCount; ++thread) {
+            m_impactVertexPairs.insert(m_impactVertexPairs.end(), m_threadPairs[thread].begin(), m_threadPairs[thread].end());
+            m_impactEdgePairs.insert(m_impactEdgePairs.end(), m_threadPairs[threadCount + thread].begin(), m_threadPairs[threadCount + thread].end());
+        }
+
+        m_impactPositions.assign(positions.begin(), positions.end());
+        m_impactTolerance = tolerance;
+        m_impactCandidatesDirty = false;
+    }
+
+    void Solver::solveContinuousCollisions(Scalar thickness) {
+        if (m_triangleBVH.empty()) return;
+
+        const Scalar tolerance = static_cast<Scalar>(1e-3) * thickness;
+        updateImpactCandidates(tolerance);
+
+        const std::vector<Vec3>& start = m_substepStart;
+        auto& positions = m_particles.getPositions();
+        const auto& inverseMasses = m_particles.getInverseMasses();
+        const auto& triangles = m_triangleBVH.getTriangles();
+        const int vertexPairCount = static_cast<int>(m_impactVertexPairs.size());
+        const int edgePairCount = static_cast<int>(m_impactEdgePairs.size());
+        const Vec3 pad = Vec3::Constant(tolerance);
+
+        // Cached candidates are culled again on the boxes swept over this substep before
+        // the cubic is solved.
+        auto sweptLower = [&](int id) { return start[id].cwiseMin(positions[id]); };
+        auto sweptUpper = [&](int id) { return start[id].cwiseMax(positions[id]); };
+        auto disjoint = [](const Vec3& lowerA, const Vec3& upperA, const Vec3& lowerB, const Vec3& upperB) {
+            return (upperA.array() < lowerB.array()).any() || (lowerA.array() > upperB.array()).any();
+        };
+        auto at = [&](int id, Scalar t) -> Vec3 { return start[id] + (positions[id] - start[id]) * t; };
+
+        auto detectVertex = [&](const SelfCollisionPair& pair, std::vector<ContinuousImpact>& impacts) {
+            const int i = pair.idA;
+            const Triangle& tri = triangles[pair.idB];
+            if (disjoint(sweptLower(tri.a).cwiseMin(sweptLower(tri.b)).cwiseMin(sweptLower(tri.c)),
+                         sweptUpper(tri.a).cwiseMax(sweptUpper(tri.b)).cwiseMax(sweptUpper(tri.c)),
+                         sweptLower(i) - pad, sweptUpper(i) + pad)) return;
+
+            Scalar time;
+            Vec3 bary;
+            if (!ContinuousCollision::vertexTriangle(start[i], positions[i], start[tri.a], positions[tri.a],
+                                                     start[tri.b], positions[tri.b], start[tri.c], positions[tri.c],
+                                                     tolerance, time, bary))
+                return;
+
+            const Vec3 xa = at(tri.a, time);
+            Vec3 normal = (at(tri.b, time) - xa).cross(at(tri.c, time) - xa);
+            if (normal.squaredNorm() < 1e-24) return;
+            normal.normalize();
+
+            // Push back to the side of the triangle the vertex started on.
+            const Vec3 startGap = start[i] - (start[tri.a] * bary.x() + start[tri.b] * bary.y() + start[tri.c] * bary.z());
+            if (startGap.dot(normal) < 0.0) normal = -normal;
+
+            impacts.push_back({ { i, tri.a, tri.b, tri.c }, { 1.0, -bary.x(), -bary.y(), -bary.z() }, normal });
+        };
+
+        auto detectEdge = [&](const SelfCollisionPair& pair, std::vector<ContinuousImpact>& impacts) {
+            const SelfCollisionPair& edge = m_meshEdges[pair.idA];
+            const SelfCollisionPair& other = m_meshEdges[pair.idB];
+            if (disjoint(sweptLower(edge.idA).cwiseMin(sweptLower(edge.idB)) - pad,
+                         sweptUpper(edge.idA).cwiseMax(sweptUpper(edge.idB)) + pad,
+                         sweptLower(other.idA).cwiseMin(sweptLower(other.idB)),
+                         sweptUpper(other.idA).cwiseMax(sweptUpper(other.idB)))) return;
+
+            Scalar time, s, t;
+            if (!ContinuousCollision::edgeEdge(start[edge.idA], positions[edge.idA], start[edge.idB], positions[edge.idB],
+                                               start[other.idA], positions[other.idA], start[other.idB], positions[other.idB],
+                                               tolerance, time, s, t))
+                return;
+
+            const Vec3 xa = at(edge.idA, time);
+            const Vec3 xc = at(other.idA, time);
+            Vec3 normal = (at(edge.idB, time) - xa).cross(at(other.idB, time) - xc);
+            if (normal.squaredNorm() < 1e-24) return;
+            normal.normalize();
+
+            const Vec3 startGap = (start[edge.idA] + (start[edge.idB] - start[edge.idA]) * s)
+                                - (start[other.idA] + (start[other.idB] - start[other.idA]) * t);
+            if (startGap.dot(normal) < 0.0) normal = -normal;
+
+            impacts.push_back({ { edge.idA, edge.idB, other.idA, other.idB }, { 1 - s, s, t - 1, -t }, normal });
+        };
+
+        const int threadCount = omp_get_max_threads();
+        m_threadImpacts.resize(2 * threadCount);
+
+        // Detection only reads positions; impacts are joined in a fixed order and resolved
+        // one after another, since each resolution changes the positions the next one sees.
+        #pragma omp parallel num_threads(threadCount)
+        {
+            const int thread = omp_get_thread_num();
+            std::vector<ContinuousImpact>& vertexImpacts = m_threadImpacts[thread];
+            std::vector<ContinuousImpact>& edgeImpacts = m_threadImpacts[threadCount + thread];
+            vertexImpacts.clear();
+            edgeImpacts.clear();
+
+            #pragma omp for schedule(static) nowait
+            for (int k = 0; k < vertexPairCount; ++k)
+                detectVertex(m_impactVertexPairs[k], vertexImpacts);
+
+            #pragma omp for schedule(static)
+            for (int k = 0; k < edgePairCount; ++k)
+                detectEdge(m_impactEdgePairs[k], edgeImpacts);
+        }
+
+        m_impacts.clear();
+        for (const auto& impacts : m_threadImpacts)
+            m_impacts.insert(m_impacts.end(), impacts.begin(), impacts.end());
+
+        for (const ContinuousImpact& impact : m_impacts) {
+            Scalar separation = 0.0;
+            Scalar wSum = 0.0;
+            for (int k = 0; k < 4; ++k) {
+                separation += impact.weights[k] * impact.normal.dot(positions[impact.ids[k]]);
+                wSum += inverseMasses[impact.ids[k]] * impact.weights[k] * impact.weights[k];
+            }
+
+            const Scalar C = separation - thickness;
+            if (C >= 0.0 || wSum < 1e-12) continue;
+
+            const Scalar deltaLambda = -C / wSum;
+            for (int k = 0; k < 4; ++k)
+                positions[impact.ids[k]] += impact.normal * (inverseMasses[impact.ids[k]] * impact.weights[k] * deltaLambda);
+            ++m_impactCount;
+        }
+    }
+
+    void Solver::applyTriangleContacts() {
+        if (m_triangleContacts.empty()) return;
+
+        const int count = m_particles.size();
+        const int contactCount = static_cast<int>(m_triangleContacts.size());
+        auto& positions = m_particles.getPositions();
+        const auto& inverseMasses = m_particles.getInverseMasses();
+
+        m_selfContactOffsets.assign(count + 1, 0);
+        for (const TriangleContact& contact : m_triangleContacts) {
+            for (int k = 0; k < 4; ++k)
+                if (contact.weights[k] != 0.0) m_selfContactOffsets[contact.ids[k] + 1]++;
+        }
+        for (int i = 0; i < count; ++i)
+            m_selfContactOffsets[i + 1] += m_selfContactOffsets[i];
+
+        m_selfContactRefs.resize(m_selfContactOffsets[count]);
+        std::vector<int> cursor(m_selfContactOffsets.begin(), m_selfContactOffsets.end() - 1);
+        for (int c = 0; c < contactCount; ++c) {
+            const TriangleContact& contact = m_triangleContacts[c];
+            for (int k = 0; k < 4; ++k)
+                if (contact.weights[k] != 0.0) m_selfContactRefs[cursor[contact.ids[k]]++] = 4 * c + k;
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < count; ++i) {
+            const int begin = m_selfContactOffsets[i];
+            const int end = m_selfContactOffsets[i + 1];
+            if (begin == end || inverseMasses[i] == 0.0) continue;
+
+            Vec3 delta = Vec3::Zero();
+            for (int r = begin; r < end; ++r) {
+                const int ref = m_selfContactRefs[r];
+                const TriangleContact& contact = m_triangleContacts[ref >> 2];
+                delta += contact.correction * contact.weights[ref & 3];
+            }
+
+            positions[i] += delta * (inverseMasses[i] / static_cast<Scalar>(end - begin));
+        }
+    }
+
+    void Solver::applyForces(World& world, Scalar dt) {
         const auto& forces = world.getForces();
+        m_uniformForce.setZero();
         for (auto& force : forces) {
-            force->apply(m_particles, dt);
+            Vec3 uniform;
+            if (force->getUniformForce(uniform))
+                m_uniformForce += uniform;
+            else
+                force->apply(m_particles, dt);
+        }
+    }
+
+    void Solver::rebuildSpatialHash() {
+        m_spatialHash.build(m_particles);
+        m_hashDirty = false;
+        m_hashBuildCount++;
+        m_substepsSinceHashBuild = 0;
+        m_hashDisplacement = 0.0;
+    }
+
+    bool Solver::needsHashRebuild() const {
+        switch (m_hashRebuildPolicy) {
+            case HashRebuildPolicy::EverySubstep:
+                return true;
+            case HashRebuildPolicy::EveryNSubsteps:
+                return m_substepsSinceHashBuild >= m_hashRebuildInterval;
+            case HashRebuildPolicy::Displacement:
+                return m_hashDisplacement + m_predictDisplacement > m_hashRebuildFraction * m_spatialHash.getCellSize();
+            default:
+                return false;
         }
     }
 
-    uint64_t Solver::getAdjacencyKey(int idA, int idB) const{
-        uint64_t low = static_cast<uint32_t>(std::min(idA, idB));
-        uint64_t high = static_cast<uint32_t>(std::max(idA, idB));
+    void Solver::setVerletSkin(Scalar skin) {
+        m_verletSkin = std::max(skin, static_cast<Scalar>(0.0));
+        m_verletDirty = true;
+        m_impactCandidatesDirty = true;
+    }
+
+    void Solver::setHashRebuildInterval(int substeps) {
+        m_hashRebuildInterval = std::max(substeps, 1);
+    }
 
-        return (high << 32) | low;
+    void Solver::setSelfCollisionExclusionRings(int rings) {
+        m_exclusionRings = std::max(rings, 1);
+        m_adjacencyDirty = true;
     }
 
     void Solver::setIterations(int count) {
@@ -168,7 +1793,17 @@ namespace ClothSDK {
         m_substeps = count;
     }
 
-    void Solver::setParticleInverseMass(int id, double invMass) {
-        m_particles[id].setInverseMass(invMass);
+    void Solver::setMinIterations(int count) {
+        m_minIterations = std::max(count, 1);
+    }
+
+    void Solver::setSubstepRange(int minCount, int maxCount) {
+        m_minSubsteps = std::max(minCount, 1);
+        m_maxSubsteps = std::max(maxCount, m_minSubsteps);
+    }
+
+    void Solver::setParticleInverseMass(int id, Scalar invMass) {
+        m_particles.setInverseMass(id, invMass);
+        m_attachmentsDirty = true;
     }
 }
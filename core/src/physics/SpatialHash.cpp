@@ -2,56 +2,95 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "physics/SpatialHash.hpp"
-#include "physics/Particle.hpp"
+#include "physics/ParticleStore.hpp"
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <omp.h>
 
 namespace ClothSDK {
 
-SpatialHash::SpatialHash(int tableSize, double cellSize)
+SpatialHash::SpatialHash(int tableSize, Scalar cellSize)
 : m_tableSize(tableSize), m_cellSize(cellSize) {}
 
-void SpatialHash::build(const std::vector<Particle>& particles) {
-    m_cellStart.assign(m_tableSize + 1, 0); 
-    m_particleHashes.resize(particles.size());
-    m_particleIndices.resize(particles.size());
-
-    for (size_t i = 0; i < particles.size(); ++i) {
-        const Eigen::Vector3d& pos = particles[i].getPosition();
-        
-        int gx = static_cast<int>(std::floor(pos.x() / m_cellSize));
-        int gy = static_cast<int>(std::floor(pos.y() / m_cellSize));
-        int gz = static_cast<int>(std::floor(pos.z() / m_cellSize));
-        
-        int h = hashCoords(gx, gy, gz);
-        
-        m_particleHashes[i] = h;
-        
-        m_cellStart[h]++;
-    }
+void SpatialHash::build(const ParticleStore& particles) {
+    const int count = particles.size();
+    const auto& positions = particles.getPositions();
+    const size_t tableSize = static_cast<size_t>(m_tableSize);
 
-    int sum = 0;
-    for (int i = 0; i < m_tableSize; ++i) {
-        int count = m_cellStart[i];
-        m_cellStart[i] = sum;
-        sum += count;
-    }
-    m_cellStart[m_tableSize] = sum;
+    m_cellStart.resize(tableSize + 1);
+    m_particleHashes.resize(count);
+    m_particleIndices.resize(count);
+
+    const int maxThreads = count >= ParallelThreshold ? omp_get_max_threads() : 1;
+    if (m_threadCounts.size() < maxThreads * tableSize)
+        m_threadCounts.resize(maxThreads * tableSize);
+    if (m_blockSums.size() < static_cast<size_t>(maxThreads) + 1)
+        m_blockSums.resize(maxThreads + 1);
+
+    #pragma omp parallel num_threads(maxThreads)
+    {
+        const int threads = omp_get_num_threads();
+        const int thread = omp_get_thread_num();
+        const int begin = static_cast<int>(static_cast<long long>(count) * thread / threads);
+        const int end = static_cast<int>(static_cast<long long>(count) * (thread + 1) / threads);
+        int* counts = &m_threadCounts[thread * tableSize];
+
+        std::fill(counts, counts + tableSize, 0);
+        for (int i = begin; i < end; ++i) {
+            int gx, gy, gz;
+            posToGrid(positions[i], gx, gy, gz);
+            int h = hashCoords(gx, gy, gz);
+            m_particleHashes[i] = h;
+            counts[h]++;
+        }
+
+        #pragma omp barrier
+
+        // Blocked exclusive scan over cells. Within a cell, lower threads come first,
+        // which keeps particles in index order.
+        const int cellBegin = static_cast<int>(static_cast<long long>(m_tableSize) * thread / threads);
+        const int cellEnd = static_cast<int>(static_cast<long long>(m_tableSize) * (thread + 1) / threads);
 
-    std::vector<int> cellOffset = m_cellStart;
+        int blockSum = 0;
+        for (int h = cellBegin; h < cellEnd; ++h)
+            for (int t = 0; t < threads; ++t)
+                blockSum += m_threadCounts[t * tableSize + h];
+        m_blockSums[thread + 1] = blockSum;
 
-    for (size_t i = 0; i < particles.size(); ++i) {
-        int hash = m_particleHashes[i];
-        int index = cellOffset[hash]++;
-        m_particleIndices[index] = i;
+        #pragma omp barrier
+        #pragma omp single
+        {
+            m_blockSums[0] = 0;
+            for (int t = 0; t < threads; ++t)
+                m_blockSums[t + 1] += m_blockSums[t];
+        }
+
+        int running = m_blockSums[thread];
+        for (int h = cellBegin; h < cellEnd; ++h) {
+            m_cellStart[h] = running;
+            for (int t = 0; t < threads; ++t) {
+                int& cursor = m_threadCounts[t * tableSize + h];
+                int cellCount = cursor;
+                cursor = running;
+                running += cellCount;
+            }
+        }
+
+        #pragma omp barrier
+
+        for (int i = begin; i < end; ++i)
+            m_particleIndices[counts[m_particleHashes[i]]++] = i;
     }
+
+    m_cellStart[m_tableSize] = count;
 }
 
-void SpatialHash::query(const std::vector<Particle>& particles, const Eigen::Vector3d& pos, double radius, std::vector<int>& outNeighbors) const {
+void SpatialHash::query(const ParticleStore& particles, const Vec3& pos, Scalar radius, std::vector<int>& outNeighbors) const {
     outNeighbors.clear();
-    Eigen::Vector3d sphereRadius(radius, radius, radius);
-    Eigen::Vector3d pMin = pos - sphereRadius;
-    Eigen::Vector3d pMax = pos + sphereRadius;
+    Vec3 sphereRadius(radius, radius, radius);
+    Vec3 pMin = pos - sphereRadius;
+    Vec3 pMax = pos + sphereRadius;
 
     int mingx, mingy, mingz;
     int maxgx, maxgy, maxgz;
@@ -67,7 +106,7 @@ void SpatialHash::query(const std::vector<Particle>& particles, const Eigen::Vec
                 int end = m_cellStart[hash + 1];
                 for (int m = start; m < end; ++m) {
                     int pIndex = m_particleIndices[m];
-                    double distance = (particles[pIndex].getPosition() - pos).squaredNorm();
+                    Scalar distance = (particles.getPosition(pIndex) - pos).squaredNorm();
                     if (distance < radius * radius)
                         outNeighbors.push_back(pIndex);
                 }
@@ -76,4 +115,40 @@ void SpatialHash::query(const std::vector<Particle>& particles, const Eigen::Vec
     }
 }
 
+void SpatialHash::queryBox(const ParticleStore& particles, const Vec3& lower, const Vec3& upper, std::vector<int>& outParticles) const {
+    outParticles.clear();
+    const auto& positions = particles.getPositions();
+    auto inside = [&](int id) {
+        return (positions[id].array() >= lower.array()).all() && (positions[id].array() <= upper.array()).all();
+    };
+
+    int mingx, mingy, mingz;
+    int maxgx, maxgy, maxgz;
+    posToGrid(lower, mingx, mingy, mingz);
+    posToGrid(upper, maxgx, maxgy, maxgz);
+
+    const long long cells = static_cast<long long>(maxgx - mingx + 3) * (maxgy - mingy + 3) * (maxgz - mingz + 3);
+    if (m_cellStart.empty() || cells >= m_tableSize || cells >= particles.size()) {
+        for (int i = 0; i < particles.size(); ++i)
+            if (inside(i)) outParticles.push_back(i);
+        return;
+    }
+
+    for (int x = mingx - 1; x <= maxgx + 1; ++x) {
+        for (int y = mingy - 1; y <= maxgy + 1; ++y) {
+            for (int z = mingz - 1; z <= maxgz + 1; ++z) {
+                int hash = hashCoords(x, y, z);
+                for (int m = m_cellStart[hash]; m < m_cellStart[hash + 1]; ++m) {
+                    int pIndex = m_particleIndices[m];
+                    if (inside(pIndex))
+                        outParticles.push_back(pIndex);
+                }
+            }
+        }
+    }
+
+    std::sort(outParticles.begin(), outParticles.end());
+    outParticles.erase(std::unique(outParticles.begin(), outParticles.end()), outParticles.end());
+}
+
 }
\ No newline at end of file
@@ -2,46 +2,82 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "physics/SphereCollider.hpp"
-#include "physics/Particle.hpp"
+#include "physics/ParticleStore.hpp"
 
 namespace ClothSDK {
 
-SphereCollider::SphereCollider(const Eigen::Vector3d& center, double radius, double friction)
-    : m_center(center), m_radius(radius) 
+SphereCollider::SphereCollider(const Vec3& center, Scalar radius, Scalar friction)
+    : m_center(center), m_radius(radius), m_frameCenter(center), m_targetCenter(center), m_previousCenter(center)
 {
     m_friction = friction;
 }
 
-void SphereCollider::resolve(std::vector<Particle>& particles, double dt, double thickness) {
+void SphereCollider::resolveParticle(Vec3& position, Vec3& oldPosition, Scalar collisionRadius) const {
+    Vec3 vec = position - m_center;
+    Scalar distance = vec.norm();
+
+    if (distance < 1e-6) {
+        vec = Vec3::UnitY() * collisionRadius;
+        distance = vec.norm();
+    }
+
+    if (distance < collisionRadius) {
+        Vec3 normal = vec.normalized();
+        
+        position = m_center + normal * collisionRadius;
+
+        Vec3 velocity = position - oldPosition;
+        Vec3 newVelocity = frictionVelocity(velocity, normal, m_center - m_previousCenter);
+
+        oldPosition = position - newVelocity;
+    }
+}
+
+void SphereCollider::resolve(ParticleStore& particles, Scalar dt, Scalar thickness) {
     
-    double collisionRadius = m_radius + thickness; 
+    Scalar collisionRadius = m_radius + thickness; 
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const int count = particles.size();
 
-    for (auto& particle : particles) {
-        Eigen::Vector3d vec = particle.getPosition() - m_center;
-        double distance = vec.norm();
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < count; ++i)
+        resolveParticle(positions[i], oldPositions[i], collisionRadius);
+}
 
-        if (distance < 1e-6) {
-            vec = Eigen::Vector3d::UnitY() * collisionRadius;
-            distance = vec.norm();
-        }
+void SphereCollider::resolve(ParticleStore& particles, const std::vector<int>& candidates, Scalar /*dt*/, Scalar thickness) {
+    Scalar collisionRadius = m_radius + thickness;
+    auto& positions = particles.getPositions();
+    auto& oldPositions = particles.getOldPositions();
+    const int count = static_cast<int>(candidates.size());
 
-        if (distance < collisionRadius) {
-            Eigen::Vector3d normal = vec.normalized();
-            
-            Eigen::Vector3d newPosition = m_center + normal * collisionRadius;
-            particle.setPosition(newPosition);
+    #pragma omp parallel for schedule(static)
+    for (int k = 0; k < count; ++k)
+        resolveParticle(positions[candidates[k]], oldPositions[candidates[k]], collisionRadius);
+}
 
-            Eigen::Vector3d velocity = particle.getPosition() - particle.getOldPosition();
-            
-            double normalVelMag = velocity.dot(normal);
-            Eigen::Vector3d normalVel = normal * normalVelMag;
-            Eigen::Vector3d tangentVel = velocity - normalVel;
+bool SphereCollider::getBounds(Vec3& outLower, Vec3& outUpper) const {
+    outLower = m_center - Vec3::Constant(m_radius);
+    outUpper = m_center + Vec3::Constant(m_radius);
+    return true;
+}
 
-            Eigen::Vector3d newVelocity = normalVel + tangentVel * (1.0 - m_friction);
+void SphereCollider::setFrameTime(Scalar alpha) {
+    m_previousCenter = m_center;
+    m_center = m_frameCenter + (m_targetCenter - m_frameCenter) * alpha;
+}
 
-            particle.setOldPosition(particle.getPosition() - newVelocity);
-        }
-    }
+void SphereCollider::endFrame() {
+    m_center = m_targetCenter;
+    m_frameCenter = m_targetCenter;
+    m_previousCenter = m_targetCenter;
+}
+
+void SphereCollider::setCenter(const Vec3& center) {
+    m_center = center;
+    m_frameCenter = center;
+    m_targetCenter = center;
+    m_previousCenter = center;
 }
 
 }
\ No newline at end of file
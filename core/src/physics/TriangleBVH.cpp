@@ -0,0 +1,151 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/TriangleBVH.hpp"
+#include <algorithm>
+
+namespace ClothSDK {
+
+void TriangleBVH::build(const std::vector<Triangle>& triangles, const std::vector<Vec3>& positions) {
+    clear();
+    m_triangles = triangles;
+    const int count = static_cast<int>(triangles.size());
+    if (count == 0) return;
+
+    std::vector<Vec3> centroids(count);
+    for (int t = 0; t < count; ++t) {
+        const Triangle& tri = triangles[t];
+        centroids[t] = (positions[tri.a] + positions[tri.b] + positions[tri.c]) / static_cast<Scalar>(3.0);
+    }
+
+    m_order.resize(count);
+    for (int t = 0; t < count; ++t) m_order[t] = t;
+
+    m_nodes.reserve(2 * (count / LeafSize + 1));
+    buildNode(0, count, 0, centroids);
+
+    // Bucket the nodes by depth so refit() can sweep the levels from the leaves up.
+    const int levels = *std::max_element(m_nodeDepths.begin(), m_nodeDepths.end()) + 1;
+    m_levelOffsets.assign(levels + 1, 0);
+    for (int depth : m_nodeDepths) m_levelOffsets[depth + 1]++;
+    for (int d = 0; d < levels; ++d) m_levelOffsets[d + 1] += m_levelOffsets[d];
+
+    m_levelNodes.resize(m_nodes.size());
+    std::vector<int> cursor(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+    for (int n = 0; n < static_cast<int>(m_nodes.size()); ++n)
+        m_levelNodes[cursor[m_nodeDepths[n]]++] = n;
+
+    refit(positions);
+}
+
+int TriangleBVH::buildNode(int first, int count, int depth, const std::vector<Vec3>& centroids) {
+    const int index = static_cast<int>(m_nodes.size());
+    m_nodes.push_back({ Vec3::Zero(), Vec3::Zero(), -1, -1, first, count });
+    m_nodeDepths.push_back(depth);
+    if (count <= LeafSize) return index;
+
+    Vec3 lower = centroids[m_order[first]];
+    Vec3 upper = lower;
+    for (int k = first; k < first + count; ++k) {
+        lower = lower.cwiseMin(centroids[m_order[k]]);
+        upper = upper.cwiseMax(centroids[m_order[k]]);
+    }
+
+    int axis = 0;
+    (upper - lower).maxCoeff(&axis);
+
+    const int half = count / 2;
+    std::nth_element(m_order.begin() + first, m_order.begin() + first + half, m_order.begin() + first + count,
+                     [&](int a, int b) { return centroids[a][axis] < centroids[b][axis]; });
+
+    const int left = buildNode(first, half, depth + 1, centroids);
+    const int right = buildNode(first + half, count - half, depth + 1, centroids);
+
+    BVHNode& node = m_nodes[index];
+    node.left = left;
+    node.right = right;
+    node.count = 0;
+    return index;
+}
+
+void TriangleBVH::fitNode(BVHNode& node, const std::vector<Vec3>& positions, const std::vector<Vec3>* endPositions) const {
+    if (!node.isLeaf()) {
+        const BVHNode& left = m_nodes[node.left];
+        const BVHNode& right = m_nodes[node.right];
+        node.lower = left.lower.cwiseMin(right.lower);
+        node.upper = left.upper.cwiseMax(right.upper);
+        return;
+    }
+
+    const Triangle& seed = m_triangles[m_order[node.first]];
+    node.lower = positions[seed.a];
+    node.upper = positions[seed.a];
+    for (int k = node.first; k < node.first + node.count; ++k) {
+        const Triangle& tri = m_triangles[m_order[k]];
+        for (int id : { tri.a, tri.b, tri.c }) {
+            node.lower = node.lower.cwiseMin(positions[id]);
+            node.upper = node.upper.cwiseMax(positions[id]);
+            if (endPositions) {
+                node.lower = node.lower.cwiseMin((*endPositions)[id]);
+                node.upper = node.upper.cwiseMax((*endPositions)[id]);
+            }
+        }
+    }
+}
+
+void TriangleBVH::refit(const std::vector<Vec3>& positions) {
+    refitLevels(positions, nullptr);
+}
+
+void TriangleBVH::refit(const std::vector<Vec3>& start, const std::vector<Vec3>& end) {
+    refitLevels(start, &end);
+}
+
+void TriangleBVH::refitLevels(const std::vector<Vec3>& positions, const std::vector<Vec3>* endPositions) {
+    const int levels = static_cast<int>(m_levelOffsets.size()) - 1;
+
+    // Children are always one level deeper than their parent, so every level only
+    // reads boxes finished by the previous sweep.
+    for (int d = levels - 1; d >= 0; --d) {
+        const int begin = m_levelOffsets[d];
+        const int end = m_levelOffsets[d + 1];
+
+        #pragma omp parallel for schedule(static) if (end - begin > 256)
+        for (int k = begin; k < end; ++k)
+            fitNode(m_nodes[m_levelNodes[k]], positions, endPositions);
+    }
+}
+
+void TriangleBVH::query(const Vec3& lower, const Vec3& upper, std::vector<int>& outTriangles) const {
+    outTriangles.clear();
+    if (m_nodes.empty()) return;
+
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const BVHNode& node = m_nodes[stack[--top]];
+        if ((node.lower.array() > upper.array()).any() || (node.upper.array() < lower.array()).any())
+            continue;
+
+        if (node.isLeaf()) {
+            for (int k = node.first; k < node.first + node.count; ++k)
+                outTriangles.push_back(m_order[k]);
+        } else {
+            stack[top++] = node.left;
+            stack[top++] = node.right;
+        }
+    }
+}
+
+void TriangleBVH::clear() {
+    m_triangles.clear();
+    m_nodes.clear();
+    m_order.clear();
+    m_nodeDepths.clear();
+    m_levelOffsets.clear();
+    m_levelNodes.clear();
+}
+
+}
@@ -0,0 +1,179 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "physics/WindField.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+
+namespace ClothSDK {
+
+namespace {
+
+    const char FileMagic[4] = { 'C', 'W', 'N', 'D' };
+    const std::int32_t FileVersion = 1;
+
+    inline int wrap(int i, int n) {
+        i %= n;
+        return i < 0 ? i + n : i;
+    }
+
+}
+
+WindField::WindField(const Vec3& origin, Scalar cellSize, int nx, int ny, int nz, const std::vector<Vec3>& velocities)
+    : m_origin(origin), m_cellSize(cellSize), m_resolution{ nx, ny, nz }
+{
+    if (nx < 1 || ny < 1 || nz < 1 || !(cellSize > 0) ||
+        velocities.size() != static_cast<size_t>(nx) * ny * nz) {
+        Logger::warn("WindField: expected " + std::to_string(nx) + "x" + std::to_string(ny) + "x" +
+                     std::to_string(nz) + " samples with a positive cell size, got " +
+                     std::to_string(velocities.size()) + "; the field will be calm");
+        m_cellSize = 1.0;
+        m_resolution[0] = m_resolution[1] = m_resolution[2] = 0;
+        return;
+    }
+
+    m_samples.resize(3 * velocities.size());
+    for (size_t k = 0; k < velocities.size(); ++k)
+        for (int axis = 0; axis < 3; ++axis)
+            m_samples[3 * k + axis] = static_cast<float>(velocities[k][axis]);
+}
+
+std::unique_ptr<WindField> WindField::turbulence(int resolution, Scalar cellSize, Scalar strength, unsigned int seed) {
+    const int n = std::max(resolution, 4);
+    const int count = n * n * n;
+    auto at = [n](int x, int y, int z) { return (wrap(z, n) * n + wrap(y, n)) * n + wrap(x, n); };
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<Vec3> potential(count);
+    for (auto& p : potential)
+        p = Vec3(uniform(rng), uniform(rng), uniform(rng));
+
+    // Two [1 2 1] blurs per axis turn white noise into blobs a few cells wide.
+    std::vector<Vec3> blurred(count);
+    const int step[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+    for (int pass = 0; pass < 2; ++pass) {
+        for (const auto& d : step) {
+            #pragma omp parallel for schedule(static)
+            for (int z = 0; z < n; ++z)
+                for (int y = 0; y < n; ++y)
+                    for (int x = 0; x < n; ++x)
+                        blurred[at(x, y, z)] = (potential[at(x - d[0], y - d[1], z - d[2])]
+                                              + potential[at(x, y, z)] * 2.0
+                                              + potential[at(x + d[0], y + d[1], z + d[2])]) * 0.25;
+            potential.swap(blurred);
+        }
+    }
+
+    // The curl of a potential has no divergence, so the gusts neither pile up nor vanish.
+    std::vector<Vec3> velocities(count);
+    double sumSq = 0.0;
+    #pragma omp parallel for schedule(static) reduction(+: sumSq)
+    for (int z = 0; z < n; ++z) {
+        for (int y = 0; y < n; ++y) {
+            for (int x = 0; x < n; ++x) {
+                const Vec3 dx = potential[at(x + 1, y, z)] - potential[at(x - 1, y, z)];
+                const Vec3 dy = potential[at(x, y + 1, z)] - potential[at(x, y - 1, z)];
+                const Vec3 dz = potential[at(x, y, z + 1)] - potential[at(x, y, z - 1)];
+                const Vec3 curl(dy.z() - dz.y(), dz.x() - dx.z(), dx.y() - dy.x());
+                velocities[at(x, y, z)] = curl;
+                sumSq += curl.squaredNorm();
+            }
+        }
+    }
+
+    const double rms = std::sqrt(sumSq / count);
+    if (rms > 0.0) {
+        const Scalar scale = static_cast<Scalar>(strength / rms);
+        for (auto& v : velocities) v *= scale;
+    }
+
+    return std::make_unique<WindField>(Vec3::Zero(), cellSize, n, n, n, velocities);
+}
+
+bool WindField::save(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    const std::int32_t resolution[3] = { m_resolution[0], m_resolution[1], m_resolution[2] };
+    const double header[7] = { static_cast<double>(m_origin.x()), static_cast<double>(m_origin.y()),
+                               static_cast<double>(m_origin.z()), static_cast<double>(m_cellSize),
+                               static_cast<double>(m_drift.x()), static_cast<double>(m_drift.y()),
+                               static_cast<double>(m_drift.z()) };
+
+    file.write(FileMagic, sizeof(FileMagic));
+    file.write(reinterpret_cast<const char*>(&FileVersion), sizeof(FileVersion));
+    file.write(reinterpret_cast<const char*>(resolution), sizeof(resolution));
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_samples.data()), m_samples.size() * sizeof(float));
+    return static_cast<bool>(file);
+}
+
+std::unique_ptr<WindField> WindField::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return nullptr;
+
+    char magic[4];
+    std::int32_t version = 0;
+    std::int32_t resolution[3];
+    double header[7];
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(resolution), sizeof(resolution));
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!file || std::memcmp(magic, FileMagic, sizeof(magic)) != 0 || version != FileVersion ||
+        resolution[0] < 1 || resolution[1] < 1 || resolution[2] < 1 || !(header[3] > 0)) {
+        Logger::warn("WindField: " + path + " is not a wind grid");
+        return nullptr;
+    }
+
+    std::unique_ptr<WindField> field(new WindField());
+    field->m_origin = Vec3(header[0], header[1], header[2]);
+    field->m_cellSize = static_cast<Scalar>(header[3]);
+    field->m_drift = Vec3(header[4], header[5], header[6]);
+    for (int axis = 0; axis < 3; ++axis)
+        field->m_resolution[axis] = resolution[axis];
+
+    field->m_samples.resize(3 * static_cast<size_t>(resolution[0]) * resolution[1] * resolution[2]);
+    file.read(reinterpret_cast<char*>(field->m_samples.data()), field->m_samples.size() * sizeof(float));
+    if (!file) {
+        Logger::warn("WindField: " + path + " is truncated");
+        return nullptr;
+    }
+    return field;
+}
+
+Vec3 WindField::sample(const Vec3& point, Scalar time) const {
+    if (m_samples.empty()) return Vec3::Zero();
+
+    const Vec3 grid = (point - m_drift * time - m_origin) / m_cellSize;
+    int lo[3], hi[3];
+    Scalar f[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        const Scalar cell = std::floor(grid[axis]);
+        f[axis] = grid[axis] - cell;
+        lo[axis] = wrap(static_cast<int>(cell), m_resolution[axis]);
+        hi[axis] = lo[axis] + 1 == m_resolution[axis] ? 0 : lo[axis] + 1;
+    }
+
+    Vec3 result = Vec3::Zero();
+    for (int corner = 0; corner < 8; ++corner) {
+        const int x = (corner & 1) ? hi[0] : lo[0];
+        const int y = (corner & 2) ? hi[1] : lo[1];
+        const int z = (corner & 4) ? hi[2] : lo[2];
+        const Scalar weight = ((corner & 1) ? f[0] : 1 - f[0])
+                            * ((corner & 2) ? f[1] : 1 - f[1])
+                            * ((corner & 4) ? f[2] : 1 - f[2]);
+        const float* s = &m_samples[3 * index(x, y, z)];
+        result += Vec3(s[0], s[1], s[2]) * weight;
+    }
+    return result;
+}
+
+}
@@ -0,0 +1,113 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+// Lane-generic XPBD distance projection shared by the SIMD translation units.
+// Include it after defining an Ops type inside an anonymous namespace so that every
+// instantiation keeps internal linkage and is compiled with that unit's target flags.
+// Do not call Eigen or other inline library templates from here: the linker could
+// merge them with copies compiled for a different instruction set.
+
+#include "physics/DistanceConstraint.hpp"
+
+namespace {
+
+template<typename Ops>
+int solveDistanceBatch(ClothSDK::DistanceConstraint* constraints, int count, ClothSDK::Scalar* positions, const ClothSDK::Scalar* inverseMasses, ClothSDK::Scalar dt,
+                       ClothSDK::ConstraintResidual* residual) {
+    using Scalar = ClothSDK::Scalar;
+    using Vec = typename Ops::Vec;
+    using Mask = typename Ops::Mask;
+    constexpr int W = Ops::Width;
+
+    alignas(64) int indexA[W];
+    alignas(64) int indexB[W];
+    alignas(64) int offsetA[W];
+    alignas(64) int offsetB[W];
+    alignas(64) Scalar restLength[W];
+    alignas(64) Scalar compliance[W];
+    alignas(64) Scalar lambda[W];
+    alignas(64) Scalar error[W];
+    alignas(64) Scalar counted[W];
+
+    const Vec zero = Ops::set1(Scalar(0));
+    const Vec one = Ops::set1(Scalar(1));
+    const Vec minLength = Ops::set1(Scalar(1e-6));
+    const Vec dt2 = Ops::set1(dt * dt);
+
+    int i = 0;
+    for (; i + W <= count; i += W) {
+        for (int l = 0; l < W; ++l) {
+            const ClothSDK::DistanceConstraint& c = constraints[i + l];
+            indexA[l] = c.idA;
+            indexB[l] = c.idB;
+            offsetA[l] = c.idA * 3;
+            offsetB[l] = c.idB * 3;
+            restLength[l] = c.restLength;
+            compliance[l] = c.compliance;
+            lambda[l] = c.lambda;
+        }
+
+        Vec ax = Ops::gather(positions + 0, offsetA);
+        Vec ay = Ops::gather(positions + 1, offsetA);
+        Vec az = Ops::gather(positions + 2, offsetA);
+        Vec bx = Ops::gather(positions + 0, offsetB);
+        Vec by = Ops::gather(positions + 1, offsetB);
+        Vec bz = Ops::gather(positions + 2, offsetB);
+        Vec wA = Ops::gather(inverseMasses, indexA);
+        Vec wB = Ops::gather(inverseMasses, indexB);
+
+        Vec dx = Ops::sub(ax, bx);
+        Vec dy = Ops::sub(ay, by);
+        Vec dz = Ops::sub(az, bz);
+        Vec length = Ops::sqrt(Ops::add(Ops::add(Ops::mul(dx, dx), Ops::mul(dy, dy)), Ops::mul(dz, dz)));
+        Vec wSum = Ops::add(wA, wB);
+
+        // Lanes the scalar path would skip get a zero correction instead.
+        Mask active = Ops::logicalAnd(Ops::cmpGe(length, minLength), Ops::cmpNe(wSum, zero));
+        Vec safeLength = Ops::select(active, length, one);
+
+        Vec nx = Ops::div(dx, safeLength);
+        Vec ny = Ops::div(dy, safeLength);
+        Vec nz = Ops::div(dz, safeLength);
+
+        Vec lambdaVec = Ops::load(lambda);
+        Vec alphaHat = Ops::div(Ops::load(compliance), dt2);
+        Vec C = Ops::sub(length, Ops::load(restLength));
+        Vec numerator = Ops::sub(Ops::sub(zero, C), Ops::mul(alphaHat, lambdaVec));
+        Vec deltaLambda = Ops::div(numerator, Ops::add(wSum, alphaHat));
+        deltaLambda = Ops::select(active, deltaLambda, zero);
+        nx = Ops::select(active, nx, zero);
+        ny = Ops::select(active, ny, zero);
+        nz = Ops::select(active, nz, zero);
+
+        Ops::store(lambda, Ops::add(lambdaVec, deltaLambda));
+
+        Ops::scatter(positions + 0, offsetA, Ops::add(ax, Ops::mul(Ops::mul(wA, nx), deltaLambda)));
+        Ops::scatter(positions + 1, offsetA, Ops::add(ay, Ops::mul(Ops::mul(wA, ny), deltaLambda)));
+        Ops::scatter(positions + 2, offsetA, Ops::add(az, Ops::mul(Ops::mul(wA, nz), deltaLambda)));
+        Ops::scatter(positions + 0, offsetB, Ops::sub(bx, Ops::mul(Ops::mul(wB, nx), deltaLambda)));
+        Ops::scatter(positions + 1, offsetB, Ops::sub(by, Ops::mul(Ops::mul(wB, ny), deltaLambda)));
+        Ops::scatter(positions + 2, offsetB, Ops::sub(bz, Ops::mul(Ops::mul(wB, nz), deltaLambda)));
+
+        for (int l = 0; l < W; ++l)
+            constraints[i + l].lambda = lambda[l];
+
+        // Spelled out rather than through ConstraintResidual::add, which is compiled
+        // without this unit's target flags.
+        if (residual) {
+            Ops::store(error, C);
+            Ops::store(counted, Ops::select(active, one, zero));
+            for (int l = 0; l < W; ++l) {
+                if (counted[l] == Scalar(0)) continue;
+                const Scalar magnitude = error[l] < Scalar(0) ? -error[l] : error[l];
+                if (magnitude > residual->max) residual->max = magnitude;
+                residual->sumSq += error[l] * error[l];
+                ++residual->count;
+            }
+        }
+    }
+
+    return i;
+}
+
+}
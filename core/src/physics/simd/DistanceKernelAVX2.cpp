@@ -0,0 +1,90 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compiled with AVX2 target flags; only reached after a runtime CPU check.
+
+#include "DistanceKernelSimd.hpp"
+#include <immintrin.h>
+
+namespace {
+
+#ifdef CLOTHSDK_USE_FLOAT
+
+struct Ops {
+    using Vec = __m256;
+    using Mask = __m256;
+    static constexpr int Width = 8;
+
+    static inline Vec set1(float v) { return _mm256_set1_ps(v); }
+    static inline Vec load(const float* p) { return _mm256_load_ps(p); }
+    static inline void store(float* p, Vec v) { _mm256_store_ps(p, v); }
+    static inline Vec add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+    static inline Vec sub(Vec a, Vec b) { return _mm256_sub_ps(a, b); }
+    static inline Vec mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+    static inline Vec div(Vec a, Vec b) { return _mm256_div_ps(a, b); }
+    static inline Vec sqrt(Vec a) { return _mm256_sqrt_ps(a); }
+    static inline Mask cmpGe(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static inline Mask cmpNe(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+    static inline Mask logicalAnd(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+    static inline Vec select(Mask m, Vec a, Vec b) { return _mm256_blendv_ps(b, a, m); }
+
+    static inline Vec gather(const float* base, const int* index) {
+        return _mm256_i32gather_ps(base, _mm256_load_si256(reinterpret_cast<const __m256i*>(index)), 4);
+    }
+
+    // AVX2 has gathers but no scatters.
+    static inline void scatter(float* base, const int* index, Vec v) {
+        alignas(32) float lanes[Width];
+        _mm256_store_ps(lanes, v);
+        for (int l = 0; l < Width; ++l)
+            base[index[l]] = lanes[l];
+    }
+};
+
+#else
+
+struct Ops {
+    using Vec = __m256d;
+    using Mask = __m256d;
+    static constexpr int Width = 4;
+
+    static inline Vec set1(double v) { return _mm256_set1_pd(v); }
+    static inline Vec load(const double* p) { return _mm256_load_pd(p); }
+    static inline void store(double* p, Vec v) { _mm256_store_pd(p, v); }
+    static inline Vec add(Vec a, Vec b) { return _mm256_add_pd(a, b); }
+    static inline Vec sub(Vec a, Vec b) { return _mm256_sub_pd(a, b); }
+    static inline Vec mul(Vec a, Vec b) { return _mm256_mul_pd(a, b); }
+    static inline Vec div(Vec a, Vec b) { return _mm256_div_pd(a, b); }
+    static inline Vec sqrt(Vec a) { return _mm256_sqrt_pd(a); }
+    static inline Mask cmpGe(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+    static inline Mask cmpNe(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+    static inline Mask logicalAnd(Mask a, Mask b) { return _mm256_and_pd(a, b); }
+    static inline Vec select(Mask m, Vec a, Vec b) { return _mm256_blendv_pd(b, a, m); }
+
+    static inline Vec gather(const double* base, const int* index) {
+        return _mm256_i32gather_pd(base, _mm_load_si128(reinterpret_cast<const __m128i*>(index)), 8);
+    }
+
+    // AVX2 has gathers but no scatters.
+    static inline void scatter(double* base, const int* index, Vec v) {
+        alignas(32) double lanes[Width];
+        _mm256_store_pd(lanes, v);
+        for (int l = 0; l < Width; ++l)
+            base[index[l]] = lanes[l];
+    }
+};
+
+#endif
+
+}
+
+#include "DistanceBatch.inl"
+
+namespace ClothSDK::simd {
+
+int solveDistanceBatchAVX2(DistanceConstraint* constraints, int count, Scalar* positions, const Scalar* inverseMasses, Scalar dt,
+                         ConstraintResidual* residual) {
+    return solveDistanceBatch<Ops>(constraints, count, positions, inverseMasses, dt, residual);
+}
+
+}
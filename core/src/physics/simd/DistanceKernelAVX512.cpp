@@ -0,0 +1,84 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compiled with AVX-512F target flags; only reached after a runtime CPU check.
+
+#include "DistanceKernelSimd.hpp"
+#include <immintrin.h>
+
+namespace {
+
+#ifdef CLOTHSDK_USE_FLOAT
+
+struct Ops {
+    using Vec = __m512;
+    using Mask = __mmask16;
+    static constexpr int Width = 16;
+
+    static inline Vec set1(float v) { return _mm512_set1_ps(v); }
+    static inline Vec load(const float* p) { return _mm512_load_ps(p); }
+    static inline void store(float* p, Vec v) { _mm512_store_ps(p, v); }
+    static inline Vec add(Vec a, Vec b) { return _mm512_add_ps(a, b); }
+    static inline Vec sub(Vec a, Vec b) { return _mm512_sub_ps(a, b); }
+    static inline Vec mul(Vec a, Vec b) { return _mm512_mul_ps(a, b); }
+    static inline Vec div(Vec a, Vec b) { return _mm512_div_ps(a, b); }
+    static inline Vec sqrt(Vec a) { return _mm512_sqrt_ps(a); }
+    static inline Mask cmpGe(Vec a, Vec b) { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+    static inline Mask cmpNe(Vec a, Vec b) { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+    static inline Mask logicalAnd(Mask a, Mask b) { return static_cast<Mask>(a & b); }
+    static inline Vec select(Mask m, Vec a, Vec b) { return _mm512_mask_blend_ps(m, b, a); }
+
+    static inline Vec gather(const float* base, const int* index) {
+        return _mm512_i32gather_ps(_mm512_load_si512(index), base, 4);
+    }
+
+    // Lanes within a color never alias, so the scatter is conflict-free.
+    static inline void scatter(float* base, const int* index, Vec v) {
+        _mm512_i32scatter_ps(base, _mm512_load_si512(index), v, 4);
+    }
+};
+
+#else
+
+struct Ops {
+    using Vec = __m512d;
+    using Mask = __mmask8;
+    static constexpr int Width = 8;
+
+    static inline Vec set1(double v) { return _mm512_set1_pd(v); }
+    static inline Vec load(const double* p) { return _mm512_load_pd(p); }
+    static inline void store(double* p, Vec v) { _mm512_store_pd(p, v); }
+    static inline Vec add(Vec a, Vec b) { return _mm512_add_pd(a, b); }
+    static inline Vec sub(Vec a, Vec b) { return _mm512_sub_pd(a, b); }
+    static inline Vec mul(Vec a, Vec b) { return _mm512_mul_pd(a, b); }
+    static inline Vec div(Vec a, Vec b) { return _mm512_div_pd(a, b); }
+    static inline Vec sqrt(Vec a) { return _mm512_sqrt_pd(a); }
+    static inline Mask cmpGe(Vec a, Vec b) { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+    static inline Mask cmpNe(Vec a, Vec b) { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); }
+    static inline Mask logicalAnd(Mask a, Mask b) { return static_cast<Mask>(a & b); }
+    static inline Vec select(Mask m, Vec a, Vec b) { return _mm512_mask_blend_pd(m, b, a); }
+
+    static inline Vec gather(const double* base, const int* index) {
+        return _mm512_i32gather_pd(_mm256_load_si256(reinterpret_cast<const __m256i*>(index)), base, 8);
+    }
+
+    // Lanes within a color never alias, so the scatter is conflict-free.
+    static inline void scatter(double* base, const int* index, Vec v) {
+        _mm512_i32scatter_pd(base, _mm256_load_si256(reinterpret_cast<const __m256i*>(index)), v, 8);
+    }
+};
+
+#endif
+
+}
+
+#include "DistanceBatch.inl"
+
+namespace ClothSDK::simd {
+
+int solveDistanceBatchAVX512(DistanceConstraint* constraints, int count, Scalar* positions, const Scalar* inverseMasses, Scalar dt,
+                         ConstraintResidual* residual) {
+    return solveDistanceBatch<Ops>(constraints, count, positions, inverseMasses, dt, residual);
+}
+
+}
@@ -0,0 +1,85 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "DistanceKernelSimd.hpp"
+#include <xmmintrin.h>
+#include <emmintrin.h>
+
+namespace {
+
+#ifdef CLOTHSDK_USE_FLOAT
+
+struct Ops {
+    using Vec = __m128;
+    using Mask = __m128;
+    static constexpr int Width = 4;
+
+    static inline Vec set1(float v) { return _mm_set1_ps(v); }
+    static inline Vec load(const float* p) { return _mm_load_ps(p); }
+    static inline void store(float* p, Vec v) { _mm_store_ps(p, v); }
+    static inline Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+    static inline Vec sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+    static inline Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+    static inline Vec div(Vec a, Vec b) { return _mm_div_ps(a, b); }
+    static inline Vec sqrt(Vec a) { return _mm_sqrt_ps(a); }
+    static inline Mask cmpGe(Vec a, Vec b) { return _mm_cmpge_ps(a, b); }
+    static inline Mask cmpNe(Vec a, Vec b) { return _mm_cmpneq_ps(a, b); }
+    static inline Mask logicalAnd(Mask a, Mask b) { return _mm_and_ps(a, b); }
+    static inline Vec select(Mask m, Vec a, Vec b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+    // SSE2 has no gather/scatter instructions, so lanes are moved one by one.
+    static inline Vec gather(const float* base, const int* index) {
+        return _mm_set_ps(base[index[3]], base[index[2]], base[index[1]], base[index[0]]);
+    }
+    static inline void scatter(float* base, const int* index, Vec v) {
+        alignas(16) float lanes[Width];
+        _mm_store_ps(lanes, v);
+        for (int l = 0; l < Width; ++l)
+            base[index[l]] = lanes[l];
+    }
+};
+
+#else
+
+struct Ops {
+    using Vec = __m128d;
+    using Mask = __m128d;
+    static constexpr int Width = 2;
+
+    static inline Vec set1(double v) { return _mm_set1_pd(v); }
+    static inline Vec load(const double* p) { return _mm_load_pd(p); }
+    static inline void store(double* p, Vec v) { _mm_store_pd(p, v); }
+    static inline Vec add(Vec a, Vec b) { return _mm_add_pd(a, b); }
+    static inline Vec sub(Vec a, Vec b) { return _mm_sub_pd(a, b); }
+    static inline Vec mul(Vec a, Vec b) { return _mm_mul_pd(a, b); }
+    static inline Vec div(Vec a, Vec b) { return _mm_div_pd(a, b); }
+    static inline Vec sqrt(Vec a) { return _mm_sqrt_pd(a); }
+    static inline Mask cmpGe(Vec a, Vec b) { return _mm_cmpge_pd(a, b); }
+    static inline Mask cmpNe(Vec a, Vec b) { return _mm_cmpneq_pd(a, b); }
+    static inline Mask logicalAnd(Mask a, Mask b) { return _mm_and_pd(a, b); }
+    static inline Vec select(Mask m, Vec a, Vec b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+
+    // SSE2 has no gather/scatter instructions, so lanes are moved one by one.
+    static inline Vec gather(const double* base, const int* index) { return _mm_set_pd(base[index[1]], base[index[0]]); }
+    static inline void scatter(double* base, const int* index, Vec v) {
+        alignas(16) double lanes[Width];
+        _mm_store_pd(lanes, v);
+        base[index[0]] = lanes[0];
+        base[index[1]] = lanes[1];
+    }
+};
+
+#endif
+
+}
+
+#include "DistanceBatch.inl"
+
+namespace ClothSDK::simd {
+
+int solveDistanceBatchSSE2(DistanceConstraint* constraints, int count, Scalar* positions, const Scalar* inverseMasses, Scalar dt,
+                         ConstraintResidual* residual) {
+    return solveDistanceBatch<Ops>(constraints, count, positions, inverseMasses, dt, residual);
+}
+
+}
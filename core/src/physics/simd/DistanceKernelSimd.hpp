@@ -0,0 +1,28 @@
+// Copyright 2026 Evan M.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "math/Scalar.hpp"
+
+namespace ClothSDK {
+
+struct DistanceConstraint;
+struct ConstraintResidual;
+
+namespace simd {
+
+// Per-ISA entry points. Each one is compiled in its own translation unit with the
+// matching target flags and returns how many leading constraints it projected
+// (always a multiple of its lane width, which
+// depends on the Scalar type); the caller finishes the tail in scalar code.
+int solveDistanceBatchSSE2(DistanceConstraint* constraints, int count, Scalar* positions, const Scalar* inverseMasses, Scalar dt,
+                         ConstraintResidual* residual);
+int solveDistanceBatchAVX2(DistanceConstraint* constraints, int count, Scalar* positions, const Scalar* inverseMasses, Scalar dt,
+                         ConstraintResidual* residual);
+int solveDistanceBatchAVX512(DistanceConstraint* constraints, int count, Scalar* positions, const Scalar* inverseMasses, Scalar dt,
+                         ConstraintResidual* residual);
+
+}
+
+}
@@ -4,12 +4,15 @@
 #include <pybind11/cast.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
+#include <stdexcept>
 #include <tuple>
 
 #include "engine/Cloth.hpp"
 #include "engine/World.hpp"
 #include "physics/Particle.hpp"
+#include "physics/ParticleStore.hpp"
 #include "physics/Constraint.hpp"
 #include "physics/DistanceConstraint.hpp"
 #include "physics/BendingConstraint.hpp"
@@ -17,9 +20,13 @@
 #include "physics/PlaneCollider.hpp"
 #include "physics/SphereCollider.hpp"
 #include "physics/CapsuleCollider.hpp"
+#include "physics/CapsuleSetCollider.hpp"
+#include "physics/MeshCollider.hpp"
+#include "physics/SDFCollider.hpp"
 #include "physics/Force.hpp"
 #include "physics/AerodynamicForce.hpp"
 #include "physics/GravityForce.hpp"
+#include "physics/WindField.hpp"
 #include "physics/Solver.hpp"
 #include "engine/ClothMesh.hpp"
 #include "io/OBJLoader.hpp"
@@ -34,6 +41,23 @@
 namespace py = pybind11;
 using namespace ClothSDK;
 
+namespace {
+
+// Unpacks a (bones, 4, 4) array of row-major bone matrices in a single copy.
+std::vector<Mat4> toBoneTransforms(py::array_t<Scalar, py::array::c_style | py::array::forcecast> bones) {
+    if (bones.ndim() != 3 || bones.shape(1) != 4 || bones.shape(2) != 4)
+        throw std::invalid_argument("bone transforms must have shape (bones, 4, 4)");
+
+    using RowMajorMat4 = Eigen::Matrix<Scalar, 4, 4, Eigen::RowMajor>;
+    const Scalar* data = bones.data();
+    std::vector<Mat4> out(bones.shape(0));
+    for (size_t b = 0; b < out.size(); ++b)
+        out[b] = Eigen::Map<const RowMajorMat4>(data + 16 * b);
+    return out;
+}
+
+}
+
 PYBIND11_MODULE(_cloth_sdk_core, m) {
     m.doc() = "ClothSDK: Professional XPBD Simulation Engine";
 
@@ -60,44 +84,126 @@ PYBIND11_MODULE(_cloth_sdk_core, m) {
     py::class_<ClothSDK::Force, std::shared_ptr<ClothSDK::Force>>(m, "Force");
 
     py::class_<ClothSDK::GravityForce, ClothSDK::Force, std::shared_ptr<ClothSDK::GravityForce>>(m, "GravityForce")
-        .def(py::init<const Eigen::Vector3d&>());
+        .def(py::init<const Vec3&>());
+
+    py::class_<WindField, std::shared_ptr<WindField>>(m, "WindField")
+        .def_static("turbulence", [](int resolution, Scalar cellSize, Scalar strength, unsigned int seed) {
+            return std::shared_ptr<WindField>(WindField::turbulence(resolution, cellSize, strength, seed));
+        }, py::arg("resolution"), py::arg("cell_size"), py::arg("strength"), py::arg("seed") = 0)
+        .def_static("load", [](const std::string& path) {
+            return std::shared_ptr<WindField>(WindField::load(path));
+        }, py::arg("path"))
+        .def("save", &WindField::save, py::arg("path"))
+        .def("sample", &WindField::sample, py::arg("point"), py::arg("time"))
+        .def("set_drift", &WindField::setDrift, py::arg("drift"))
+        .def("get_drift", &WindField::getDrift)
+        .def("get_cell_size", &WindField::getCellSize);
 
     py::class_<ClothSDK::AerodynamicForce, ClothSDK::Force, std::shared_ptr<ClothSDK::AerodynamicForce>>(m, "AerodynamicForce")
-        .def(py::init<const std::vector<AeroFace>&, const Eigen::Vector3d&, double>());
+        .def(py::init<const std::vector<AeroFace>&, const Vec3&, Scalar>())
+        .def("set_wind_field", &AerodynamicForce::setWindField, py::arg("field"))
+        .def("get_wind_field", &AerodynamicForce::getWindField);
 
     py::class_<Particle>(m, "Particle")
-        .def(py::init<const Eigen::Vector3d&>(), py::arg("initial_pos"))
+        .def(py::init<const Vec3&>(), py::arg("initial_pos"))
         .def("get_position", &Particle::getPosition)
         .def("set_position", &Particle::setPosition)
         .def("get_inverse_mass", &Particle::getInverseMass)
         .def("set_inverse_mass", &Particle::setInverseMass)
         .def("add_force", &Particle::addForce)
-        .def("integrate", &Particle::integrate);
+        .def("integrate", &Particle::integrate, py::arg("delta_time"), py::arg("damping") = 0.98);
+
+    py::class_<ParticleStore>(m, "ParticleStore")
+        .def(py::init<>())
+        .def("add", &ParticleStore::add, py::arg("particle"))
+        .def("size", &ParticleStore::size)
+        .def("get_position", &ParticleStore::getPosition, py::arg("id"))
+        .def("get_inverse_mass", &ParticleStore::getInverseMass, py::arg("id"))
+        .def("get_positions", py::overload_cast<>(&ParticleStore::getPositions, py::const_), py::return_value_policy::reference_internal);
 
     py::class_<Constraint, std::unique_ptr<Constraint>>(m, "Constraint")
         .def("reset_lambda", &Constraint::resetLambda);
 
-    py::class_<DistanceConstraint, Constraint, std::unique_ptr<DistanceConstraint>>(m, "DistanceConstraint")
-        .def(py::init<int, int, double, double>(), py::arg("idA"), py::arg("idB"), py::arg("restLength"), py::arg("compliance"));
+    py::class_<DistanceConstraint>(m, "DistanceConstraint")
+        .def(py::init<int, int, Scalar, Scalar>(), py::arg("idA"), py::arg("idB"), py::arg("restLength"), py::arg("compliance"))
+        .def_readwrite("id_a", &DistanceConstraint::idA)
+        .def_readwrite("id_b", &DistanceConstraint::idB)
+        .def_readwrite("rest_length", &DistanceConstraint::restLength)
+        .def_readwrite("compliance", &DistanceConstraint::compliance)
+        .def("reset_lambda", &DistanceConstraint::resetLambda);
 
-    py::class_<BendingConstraint, Constraint, std::unique_ptr<BendingConstraint>>(m, "BendingConstraint")
-        .def(py::init<int, int, int, int, double, double>(), py::arg("idA"), py::arg("idB"), py::arg("idC"), py::arg("idD"), py::arg("restAngle"), py::arg("compliance"));
+    py::class_<BendingConstraint>(m, "BendingConstraint")
+        .def(py::init<int, int, int, int, Scalar, Scalar>(), py::arg("idA"), py::arg("idB"), py::arg("idC"), py::arg("idD"), py::arg("restAngle"), py::arg("compliance"))
+        .def_readwrite("rest_angle", &BendingConstraint::restAngle)
+        .def_readwrite("compliance", &BendingConstraint::compliance)
+        .def("reset_lambda", &BendingConstraint::resetLambda);
 
     py::class_<Collider, std::unique_ptr<Collider>>(m, "Collider")
         .def("get_friction", &Collider::getFriction)
-        .def("set_friction", &Collider::setFriction);
+        .def("set_friction", &Collider::setFriction)
+        .def("get_bounds", [](const Collider& collider) -> py::object {
+            Vec3 lower, upper;
+            if (!collider.getBounds(lower, upper)) return py::none();
+            return py::make_tuple(lower, upper);
+        });
 
     py::class_<PlaneCollider, Collider, std::unique_ptr<PlaneCollider>>(m, "PlaneCollider")
-        .def(py::init<const Eigen::Vector3d&, const Eigen::Vector3d&, double>(), py::arg("origin"), py::arg("normal"), py::arg("friction"));
+        .def(py::init<const Vec3&, const Vec3&, Scalar>(), py::arg("origin"), py::arg("normal"), py::arg("friction"));
 
     py::class_<SphereCollider, Collider, std::unique_ptr<SphereCollider>>(m, "SphereCollider")
-        .def(py::init<const Eigen::Vector3d&, double, double>(), py::arg("center"), py::arg("radius"), py::arg("friction"));
+        .def(py::init<const Vec3&, Scalar, Scalar>(), py::arg("center"), py::arg("radius"), py::arg("friction"))
+        .def("set_center", &SphereCollider::setCenter, py::arg("center"))
+        .def("set_target_center", &SphereCollider::setTargetCenter, py::arg("center"))
+        .def("get_center", &SphereCollider::getCenter)
+        .def("get_target_center", &SphereCollider::getTargetCenter)
+        .def("get_radius", &SphereCollider::getRadius);
 
     py::class_<CapsuleCollider, Collider, std::unique_ptr<CapsuleCollider>>(m, "CapsuleCollider")
-        .def(py::init<double, const Eigen::Vector3d&, const Eigen::Vector3d&, double>(), py::arg("radius"), py::arg("start"), py::arg("end"), py::arg("friction"));
+        .def(py::init<Scalar, const Vec3&, const Vec3&, Scalar>(), py::arg("radius"), py::arg("start"), py::arg("end"), py::arg("friction"))
+        .def("set_pose", &CapsuleCollider::setPose, py::arg("start"), py::arg("end"))
+        .def("set_target_pose", &CapsuleCollider::setTargetPose, py::arg("start"), py::arg("end"))
+        .def("get_radius", &CapsuleCollider::getRadius)
+        .def("get_start", &CapsuleCollider::getStart)
+        .def("get_end", &CapsuleCollider::getEnd);
+
+    py::class_<CapsuleSetCollider, Collider, std::unique_ptr<CapsuleSetCollider>>(m, "CapsuleSetCollider")
+        .def(py::init<Scalar>(), py::arg("friction"))
+        .def("add_capsule", &CapsuleSetCollider::addCapsule, py::arg("bone"), py::arg("radius"), py::arg("start"), py::arg("end"))
+        .def("set_bone_transforms", [](CapsuleSetCollider& collider, py::array_t<Scalar, py::array::c_style | py::array::forcecast> bones) {
+            collider.setBoneTransforms(toBoneTransforms(bones));
+        }, py::arg("bones"))
+        .def("set_target_bone_transforms", [](CapsuleSetCollider& collider, py::array_t<Scalar, py::array::c_style | py::array::forcecast> bones) {
+            collider.setTargetBoneTransforms(toBoneTransforms(bones));
+        }, py::arg("bones"))
+        .def("get_capsule_count", &CapsuleSetCollider::getCapsuleCount)
+        .def("get_bone_count", &CapsuleSetCollider::getBoneCount)
+        .def("get_starts", &CapsuleSetCollider::getStarts)
+        .def("get_ends", &CapsuleSetCollider::getEnds)
+        .def("get_radii", &CapsuleSetCollider::getRadii);
+
+    py::class_<MeshCollider, Collider, std::unique_ptr<MeshCollider>>(m, "MeshCollider")
+        .def(py::init<const std::vector<Vec3>&, const std::vector<Triangle>&, Scalar>(), py::arg("vertices"), py::arg("triangles"), py::arg("friction"))
+        .def_static("from_obj", &MeshCollider::fromOBJ, py::arg("path"), py::arg("friction"))
+        .def("set_transform", &MeshCollider::setTransform, py::arg("rotation"), py::arg("translation"))
+        .def("set_target_transform", &MeshCollider::setTargetTransform, py::arg("rotation"), py::arg("translation"))
+        .def("get_rotation", &MeshCollider::getRotation)
+        .def("get_translation", &MeshCollider::getTranslation);
+
+    py::class_<SDFCollider, Collider, std::unique_ptr<SDFCollider>>(m, "SDFCollider")
+        .def(py::init<const MeshCollider&, Scalar, int, Scalar>(), py::arg("mesh"), py::arg("cell_size"), py::arg("band_cells"), py::arg("friction"))
+        .def_static("from_obj", &SDFCollider::fromOBJ, py::arg("path"), py::arg("cell_size"), py::arg("band_cells"), py::arg("friction"))
+        .def_static("load", &SDFCollider::load, py::arg("path"), py::arg("friction"))
+        .def("save", &SDFCollider::save, py::arg("path"))
+        .def("sample", [](const SDFCollider& sdf, const Vec3& point) {
+            Vec3 gradient;
+            Scalar distance = sdf.sample(point, gradient);
+            return std::make_tuple(distance, gradient);
+        }, py::arg("point"))
+        .def("get_cell_size", &SDFCollider::getCellSize)
+        .def("get_band_width", &SDFCollider::getBandWidth);
 
     py::class_<SpatialHash>(m, "SpatialHash")
-    .def(py::init<int, double>(), py::arg("table_size"), py::arg("cell_size"))
+    .def(py::init<int, Scalar>(), py::arg("table_size"), py::arg("cell_size"))
     .def("build", &SpatialHash::build, py::arg("particles"))
     .def("query", &SpatialHash::query, 
         py::arg("particles"), py::arg("pos"), py::arg("radius"), py::arg("out_neighbors"));
@@ -119,12 +225,58 @@ PYBIND11_MODULE(_cloth_sdk_core, m) {
         .def("get_wind", &World::getWind)
         .def("get_air_density", &World::getAirDensity);
 
+    py::enum_<ConstraintSolveMode>(m, "ConstraintSolveMode")
+        .value("SEQUENTIAL", ConstraintSolveMode::Sequential)
+        .value("COLORED", ConstraintSolveMode::Colored);
+
+    py::enum_<SelfCollisionMode>(m, "SelfCollisionMode")
+        .value("SEQUENTIAL", SelfCollisionMode::Sequential)
+        .value("PARALLEL", SelfCollisionMode::Parallel);
+
+    py::enum_<SelfCollisionBackend>(m, "SelfCollisionBackend")
+        .value("SPATIAL_HASH", SelfCollisionBackend::SpatialHash)
+        .value("VERLET_LIST", SelfCollisionBackend::VerletList)
+        .value("TRIANGLE_BVH", SelfCollisionBackend::TriangleBVH);
+
+    py::enum_<HashRebuildPolicy>(m, "HashRebuildPolicy")
+        .value("PER_FRAME", HashRebuildPolicy::PerFrame)
+        .value("EVERY_SUBSTEP", HashRebuildPolicy::EverySubstep)
+        .value("EVERY_N_SUBSTEPS", HashRebuildPolicy::EveryNSubsteps)
+        .value("DISPLACEMENT", HashRebuildPolicy::Displacement);
+
+    py::enum_<ParticleOrderingMethod>(m, "ParticleOrderingMethod")
+        .value("MORTON", ParticleOrderingMethod::Morton)
+        .value("REVERSE_CUTHILL_MCKEE", ParticleOrderingMethod::ReverseCuthillMcKee);
+
+    py::enum_<SimdLevel>(m, "SimdLevel")
+        .value("SCALAR", SimdLevel::Scalar)
+        .value("SSE2", SimdLevel::SSE2)
+        .value("AVX2", SimdLevel::AVX2)
+        .value("AVX512", SimdLevel::AVX512);
+
+    py::enum_<IterationAcceleration>(m, "IterationAcceleration")
+        .value("NONE", IterationAcceleration::None)
+        .value("OVER_RELAXATION", IterationAcceleration::OverRelaxation)
+        .value("CHEBYSHEV", IterationAcceleration::Chebyshev);
+
+    py::class_<FrameStats>(m, "FrameStats")
+        .def_readonly("substeps", &FrameStats::substeps)
+        .def_readonly("iterations", &FrameStats::iterations)
+        .def_readonly("residual_max", &FrameStats::residualMax)
+        .def_readonly("residual_rms", &FrameStats::residualRms)
+        .def_readonly("max_speed", &FrameStats::maxSpeed)
+        .def_readonly("max_penetration", &FrameStats::maxPenetration)
+        .def_readonly("active_particles", &FrameStats::activeParticles)
+        .def_readonly("sleeping_islands", &FrameStats::sleepingIslands);
+
     py::class_<Solver, std::shared_ptr<ClothSDK::Solver>>(m, "Solver")
         .def(py::init<>())
         .def("update", &Solver::update, py::arg("world"), py::arg("delta_time"))
         .def("clear", &Solver::clear)
         .def("add_particle", &Solver::addParticle)
         .def("get_particles", &Solver::getParticles, py::return_value_policy::reference_internal)
+        .def("get_particle_store", &Solver::getParticleStore, py::return_value_policy::reference_internal)
+        .def("get_particle_count", &Solver::getParticleCount)
         .def("set_substeps", &Solver::setSubsteps)
         .def("set_iterations", &Solver::setIterations)
         .def("get_iterations", &Solver::getIterations)
@@ -132,7 +284,68 @@ PYBIND11_MODULE(_cloth_sdk_core, m) {
         .def("add_distance_constraint", &Solver::addDistanceConstraint)
         .def("add_bending_constraint", &Solver::addBendingConstraint)
         .def("add_pin", &Solver::addPin)
-        .def("set_collision_compliance", &Solver::setCollisionCompliance);
+        .def("add_contact_constraint", &Solver::addContactConstraint,
+            py::arg("id_a"), py::arg("id_b"), py::arg("thickness"), py::arg("compliance"))
+        .def("set_collision_compliance", &Solver::setCollisionCompliance)
+        .def("set_constraint_solve_mode", &Solver::setConstraintSolveMode, py::arg("mode"))
+        .def("get_constraint_solve_mode", &Solver::getConstraintSolveMode)
+        .def("get_constraint_batch_count", &Solver::getConstraintBatchCount)
+        .def("set_self_collision_mode", &Solver::setSelfCollisionMode, py::arg("mode"))
+        .def("get_self_collision_mode", &Solver::getSelfCollisionMode)
+        .def("set_self_collision_exclusion_rings", &Solver::setSelfCollisionExclusionRings, py::arg("rings"))
+        .def("get_self_collision_exclusion_rings", &Solver::getSelfCollisionExclusionRings)
+        .def("set_self_collision_backend", &Solver::setSelfCollisionBackend, py::arg("backend"))
+        .def("get_self_collision_backend", &Solver::getSelfCollisionBackend)
+        .def("set_verlet_skin", &Solver::setVerletSkin, py::arg("skin"))
+        .def("get_verlet_skin", &Solver::getVerletSkin)
+        .def("get_verlet_pair_count", &Solver::getVerletPairCount)
+        .def("set_hash_rebuild_policy", &Solver::setHashRebuildPolicy, py::arg("policy"))
+        .def("get_hash_rebuild_policy", &Solver::getHashRebuildPolicy)
+        .def("set_hash_rebuild_interval", &Solver::setHashRebuildInterval, py::arg("substeps"))
+        .def("get_hash_rebuild_interval", &Solver::getHashRebuildInterval)
+        .def("set_hash_rebuild_displacement", &Solver::setHashRebuildDisplacement, py::arg("fraction"))
+        .def("get_hash_rebuild_displacement", &Solver::getHashRebuildDisplacement)
+        .def("get_hash_build_count", &Solver::getHashBuildCount)
+        .def("set_simd_level", &Solver::setSimdLevel, py::arg("level"))
+        .def("get_simd_level", &Solver::getSimdLevel)
+        .def("set_continuous_collision", &Solver::setContinuousCollision, py::arg("enabled"))
+        .def("is_continuous_collision_enabled", &Solver::isContinuousCollisionEnabled)
+        .def("get_continuous_impact_count", &Solver::getContinuousImpactCount)
+        .def("set_damping", &Solver::setDamping, py::arg("damping"))
+        .def("get_damping", &Solver::getDamping)
+        .def("set_iteration_acceleration", &Solver::setIterationAcceleration, py::arg("mode"))
+        .def("get_iteration_acceleration", &Solver::getIterationAcceleration)
+        .def("set_over_relaxation", &Solver::setOverRelaxation, py::arg("omega"))
+        .def("get_over_relaxation", &Solver::getOverRelaxation)
+        .def("set_spectral_radius", &Solver::setSpectralRadius, py::arg("rho"))
+        .def("get_spectral_radius", &Solver::getSpectralRadius)
+        .def("set_residual_tolerance", &Solver::setResidualTolerance, py::arg("tolerance"))
+        .def("get_residual_tolerance", &Solver::getResidualTolerance)
+        .def("set_min_iterations", &Solver::setMinIterations, py::arg("count"))
+        .def("get_min_iterations", &Solver::getMinIterations)
+        .def("set_adaptive_substeps", &Solver::setAdaptiveSubsteps, py::arg("enabled"))
+        .def("is_adaptive_substeps_enabled", &Solver::isAdaptiveSubstepsEnabled)
+        .def("set_substep_range", &Solver::setSubstepRange, py::arg("min_count"), py::arg("max_count"))
+        .def("get_min_substeps", &Solver::getMinSubsteps)
+        .def("get_max_substeps", &Solver::getMaxSubsteps)
+        .def("set_max_substep_motion", &Solver::setMaxSubstepMotion, py::arg("fraction"))
+        .def("get_max_substep_motion", &Solver::getMaxSubstepMotion)
+        .def("get_frame_stats", &Solver::getFrameStats, py::return_value_policy::reference_internal)
+        .def("set_collider_broad_phase", &Solver::setColliderBroadPhase, py::arg("enabled"))
+        .def("is_collider_broad_phase_enabled", &Solver::isColliderBroadPhaseEnabled)
+        .def("set_long_range_attachments", &Solver::setLongRangeAttachments, py::arg("enabled"))
+        .def("is_long_range_attachments_enabled", &Solver::isLongRangeAttachmentsEnabled)
+        .def("set_sleeping", &Solver::setSleeping, py::arg("enabled"))
+        .def("is_sleeping_enabled", &Solver::isSleepingEnabled)
+        .def("set_sleep_threshold", &Solver::setSleepThreshold, py::arg("energy"))
+        .def("get_sleep_threshold", &Solver::getSleepThreshold)
+        .def("set_sleep_frames", &Solver::setSleepFrames, py::arg("frames"))
+        .def("get_sleep_frames", &Solver::getSleepFrames)
+        .def("get_island_count", &Solver::getIslandCount)
+        .def("is_particle_sleeping", &Solver::isParticleSleeping, py::arg("id"))
+        .def("reorder_particles", &Solver::reorderParticles, py::arg("world"), py::arg("method"))
+        .def("get_internal_index", &Solver::getInternalIndex, py::arg("external_id"))
+        .def("get_external_index", &Solver::getExternalIndex, py::arg("internal_index"));
 
     py::class_<ClothMesh, std::shared_ptr<ClothSDK::ClothMesh>>(m, "ClothMesh")
         .def(py::init<>())
@@ -160,7 +373,7 @@ PYBIND11_MODULE(_cloth_sdk_core, m) {
 
     py::class_<OBJLoader>(m, "OBJLoader")
         .def_static("load", [](const std::string& path) {
-        std::vector<Eigen::Vector3d> pos;
+        std::vector<Vec3> pos;
         std::vector<int> indices;
         bool success = ClothSDK::OBJLoader::load(path, pos, indices);
         
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "physics/Solver.hpp"
+#include "engine/World.hpp"
+#include "physics/GravityForce.hpp"
+#include <cmath>
+#include <memory>
+#include <utility>
+
+using namespace ClothSDK;
+
+TEST(AdaptiveSteppingTest, ResidualToleranceEndsIterationsEarly) {
+    auto run = [](bool gravity, Scalar tolerance) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(4);
+        solver.setIterations(10);
+        solver.setMinIterations(2);
+        solver.setResidualTolerance(tolerance);
+
+        // Flat quad hinged on its diagonal, pinned at one corner.
+        const int a = solver.addParticle(Particle(Vec3(0.0, 0.0, 0.0)));
+        const int b = solver.addParticle(Particle(Vec3(0.1, 0.1, 0.0)));
+        const int c = solver.addParticle(Particle(Vec3(0.1, 0.0, 0.0)));
+        const int d = solver.addParticle(Particle(Vec3(0.0, 0.1, 0.0)));
+        solver.setParticleInverseMass(a, 0.0);
+        for (auto edge : { std::make_pair(a, b), std::make_pair(a, c), std::make_pair(a, d),
+                           std::make_pair(b, c), std::make_pair(b, d) })
+            solver.addDistanceConstraint(edge.first, edge.second, 0.0);
+        solver.addBendingConstraint(a, b, c, d, M_PI, 0.0);
+        if (gravity)
+            world.addForce(std::make_shared<GravityForce>(world.getGravity()));
+
+        solver.update(world, 0.01);
+        return solver.getFrameStats();
+    };
+
+    // A quad at rest converges at once, so every substep stops at the minimum.
+    FrameStats resting = run(false, 1e-4);
+    EXPECT_EQ(resting.substeps, 4);
+    EXPECT_EQ(resting.iterations, 8);
+    EXPECT_LT(resting.residualMax, 1e-4);
+
+    // An unreachable tolerance runs the full iteration budget.
+    FrameStats falling = run(true, 1e-30);
+    EXPECT_EQ(falling.iterations, 40);
+    EXPECT_GT(falling.residualMax, 0.0);
+    EXPECT_LE(falling.residualRms, falling.residualMax);
+}
+
+TEST(AdaptiveSteppingTest, SubstepsFollowParticleSpeed) {
+    World world;
+    world.setThickness(0.02);
+    Solver solver;
+    solver.setDamping(1.0);
+    solver.setAdaptiveSubsteps(true);
+    solver.setSubstepRange(1, 64);
+    solver.setMaxSubstepMotion(0.5);
+
+    // 20 m/s, expressed as the motion of one 0.01 s substep.
+    Particle p(Vec3(0.0, 0.0, 0.0));
+    p.setOldPosition(Vec3(-0.2, 0.0, 0.0));
+    solver.addParticle(p);
+
+    solver.update(world, 0.01);
+    EXPECT_EQ(solver.getFrameStats().substeps, 1);
+    EXPECT_NEAR(solver.getFrameStats().maxSpeed, 20.0, 1e-3);
+
+    // 0.2 per frame at no more than 0.01 per substep.
+    solver.update(world, 0.01);
+    EXPECT_GE(solver.getFrameStats().substeps, 20);
+    EXPECT_LE(solver.getFrameStats().substeps, 21);
+    EXPECT_NEAR(solver.getFrameStats().maxSpeed, 20.0, 1e-3);
+}
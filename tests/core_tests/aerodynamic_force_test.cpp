@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "physics/AerodynamicForce.hpp"
+#include "physics/ParticleStore.hpp"
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+// Builds a wavy grid moving with a position-dependent velocity.
+void buildGrid(int n, ParticleStore& store, std::vector<AeroFace>& faces) {
+    const Scalar dt = 0.01;
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            Vec3 p(0.1 * x, 0.1 * y, 0.02 * std::sin(0.7 * x + 0.3 * y));
+            int id = store.add(Particle(p));
+            store.getOldPositions()[id] = p - dt * Vec3(0.3 * std::cos(0.5 * x), 0.1, 0.5 + 0.2 * std::sin(0.4 * y));
+        }
+    }
+    for (int y = 0; y + 1 < n; ++y) {
+        for (int x = 0; x + 1 < n; ++x) {
+            int i = y * n + x;
+            faces.push_back({ i, i + 1, i + n });
+            faces.push_back({ i + 1, i + n + 1, i + n });
+        }
+    }
+}
+
+}
+
+TEST(AerodynamicForceTest, GatherMatchesPerFaceScatter) {
+    ParticleStore store;
+    std::vector<AeroFace> faces;
+    buildGrid(24, store, faces);
+
+    const Vec3 wind(1.0, 0.0, 0.5);
+    const Scalar density = 1.2;
+    const Scalar dt = 0.01;
+
+    AerodynamicForce aero(faces, wind, density);
+    aero.apply(store, dt);
+
+    // Serial scatter with the same formula and the gust of the first application.
+    const Scalar gust = std::sin(dt * 5.0) * 0.5 + 0.5;
+    const Vec3 currentWind = wind * (1.0 + gust);
+    std::vector<Vec3> expected(store.size(), Vec3::Zero());
+    for (const auto& face : faces) {
+        Vec3 vRel = (store.getVelocity(face.a, dt) + store.getVelocity(face.b, dt) + store.getVelocity(face.c, dt)) / 3.0
+                  - currentWind;
+        Vec3 n = (store.getPosition(face.b) - store.getPosition(face.a)).cross(store.getPosition(face.c) - store.getPosition(face.a));
+        Scalar vMag = vRel.norm();
+        Vec3 normal = n.normalized();
+        Vec3 force = -0.5 * density * vMag * vMag * (0.5 * n.norm()) * (vRel.dot(normal) / vMag) * normal;
+        for (int id : { face.a, face.b, face.c })
+            expected[id] += force / 3.0 * store.getInverseMass(id);
+    }
+
+    const double tolerance = std::is_same<Scalar, float>::value ? 1e-4 : 1e-10;
+    for (int i = 0; i < store.size(); ++i)
+        EXPECT_NEAR((store.getAcceleration(i) - expected[i]).norm(), 0.0, tolerance) << "particle " << i;
+}
+
+TEST(AerodynamicForceTest, RemappedFacesFollowTheirParticles) {
+    ParticleStore store;
+    std::vector<AeroFace> faces;
+    buildGrid(6, store, faces);
+
+    // Reverse the particle order in a second store and remap the faces to match.
+    const int count = store.size();
+    ParticleStore reversed;
+    std::vector<int> newIndex(count);
+    for (int i = 0; i < count; ++i) {
+        newIndex[count - 1 - i] = i;
+        int id = reversed.add(Particle(store.getPosition(count - 1 - i)));
+        reversed.getOldPositions()[id] = store.getOldPosition(count - 1 - i);
+    }
+
+    // One application before the remap caches the vertex-to-face rows.
+    AerodynamicForce remapped(faces, Vec3(1.0, 0.0, 0.5), 1.2);
+    remapped.apply(reversed, 0.01);
+    for (int i = 0; i < count; ++i)
+        reversed.getAccelerations()[i] = Vec3::Zero();
+    remapped.remapParticles(newIndex);
+
+    // Advance the reference by one application too, so both see the same gust.
+    AerodynamicForce reference(faces, Vec3(1.0, 0.0, 0.5), 1.2);
+    reference.apply(store, 0.01);
+    for (int i = 0; i < count; ++i)
+        store.getAccelerations()[i] = Vec3::Zero();
+    reference.apply(store, 0.01);
+    remapped.apply(reversed, 0.01);
+
+    const double tolerance = std::is_same<Scalar, float>::value ? 1e-5 : 1e-12;
+    for (int i = 0; i < count; ++i)
+        EXPECT_NEAR((reversed.getAcceleration(newIndex[i]) - store.getAcceleration(i)).norm(), 0.0, tolerance);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "physics/AttachmentConstraint.hpp"
+#include "physics/GravityForce.hpp"
+#include "physics/ParticleStore.hpp"
+#include "physics/Solver.hpp"
+#include "engine/World.hpp"
+#include <cmath>
+#include <memory>
+
+using namespace ClothSDK;
+
+TEST(AttachmentConstraintTest, OnlyPullsBackWhenTooFar) {
+    ParticleStore store;
+    int anchor = store.add(Particle(Vec3(0.0, 0.0, 0.0)));
+    int id = store.add(Particle(Vec3(0.0, -0.5, 0.0)));
+
+    AttachmentConstraint attachment(id, anchor, 1.0);
+    attachment.solve(store);
+    EXPECT_TRUE(store.getPosition(id).isApprox(Vec3(0.0, -0.5, 0.0)));
+
+    store.setPosition(id, Vec3(0.0, -2.0, 0.0));
+    attachment.solve(store);
+    EXPECT_TRUE(store.getPosition(id).isApprox(Vec3(0.0, -1.0, 0.0)));
+    EXPECT_TRUE(store.getPosition(anchor).isApprox(Vec3::Zero()));
+}
+
+TEST(AttachmentConstraintTest, GeneratedFromTheNearestPinAlongTheGraph) {
+    // A U-shaped chain: 0 - 1 - 2 - 3 - 4 with 0 and 4 pinned, so 2 is reachable from both.
+    World world;
+    Solver solver;
+    const Vec3 points[] = { Vec3(0, 0, 0), Vec3(0, -1, 0), Vec3(0.5, -1.5, 0), Vec3(1, -1, 0), Vec3(1, 0, 0) };
+    for (const Vec3& p : points)
+        solver.addParticle(Particle(p));
+    for (int i = 0; i + 1 < 5; ++i)
+        solver.addDistanceConstraint(i, i + 1, 0.0);
+    solver.addPin(0, points[0]);
+    solver.setParticleInverseMass(4, 0.0);
+    solver.setLongRangeAttachments(true);
+    solver.update(world, 0.01);
+
+    const auto& attachments = solver.getAttachmentConstraints();
+    ASSERT_EQ(attachments.size(), 3u);
+    for (const AttachmentConstraint& a : attachments) {
+        if (a.particleId == 1) {
+            EXPECT_EQ(a.anchorId, 0);
+            EXPECT_NEAR(a.maxDistance, 1.0, 1e-6);
+        } else if (a.particleId == 3) {
+            EXPECT_EQ(a.anchorId, 4);
+            EXPECT_NEAR(a.maxDistance, 1.0, 1e-6);
+        } else {
+            EXPECT_EQ(a.particleId, 2);
+            EXPECT_NEAR(a.maxDistance, 1.0 + std::sqrt(0.5), 1e-6);
+        }
+    }
+
+    // Adding a pin regenerates them on the next update.
+    solver.addPin(2, solver.getParticleStore().getPosition(2));
+    solver.update(world, 0.01);
+    EXPECT_EQ(solver.getAttachmentConstraints().size(), 2u);
+}
+
+TEST(AttachmentConstraintTest, HangingChainStaysWithinItsLength) {
+    auto run = [](bool attachments) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(2);
+        solver.setIterations(1);
+        solver.setLongRangeAttachments(attachments);
+
+        for (int i = 0; i < 40; ++i)
+            solver.addParticle(Particle(Vec3(0.0, -0.05 * i, 0.0)));
+        solver.addPin(0, Vec3::Zero());
+        for (int i = 0; i + 1 < 40; ++i)
+            solver.addDistanceConstraint(i, i + 1, 0.0);
+        world.addForce(std::make_shared<GravityForce>(world.getGravity()));
+
+        for (int frame = 0; frame < 30; ++frame)
+            solver.update(world, 1.0 / 60.0);
+        return solver.getParticleStore().getPosition(39).norm();
+    };
+
+    const Scalar length = 0.05 * 39;
+    EXPECT_GT(run(false), length * 1.05);
+    EXPECT_LE(run(true), length * (1 + 1e-6));
+}
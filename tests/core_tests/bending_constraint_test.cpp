@@ -1,33 +1,33 @@
 #include <gtest/gtest.h>
 #include "physics/BendingConstraint.hpp"
-#include "physics/Particle.hpp"
+#include "physics/ParticleStore.hpp"
 #include <vector>
 #include <cmath>
 
 using namespace ClothSDK;
 
-double calculateAngle(const Eigen::Vector3d& pA, const Eigen::Vector3d& pB, 
-                      const Eigen::Vector3d& pC, const Eigen::Vector3d& pD) {
-    Eigen::Vector3d edge = pB - pA;
-    Eigen::Vector3d n1 = edge.cross(pC - pA);
-    Eigen::Vector3d n2 = edge.cross(pD - pA);
-    return std::acos(std::clamp(n1.dot(n2) / (n1.norm() * n2.norm()), -1.0, 1.0));
+double calculateAngle(const Vec3& pA, const Vec3& pB, 
+                      const Vec3& pC, const Vec3& pD) {
+    Vec3 edge = pB - pA;
+    Vec3 n1 = edge.cross(pC - pA);
+    Vec3 n2 = edge.cross(pD - pA);
+    return std::acos(std::clamp(static_cast<double>(n1.dot(n2) / (n1.norm() * n2.norm())), -1.0, 1.0));
 }
 
 TEST(BendingConstraintTest, NoMovementAtRest) {
-    std::vector<Particle> particles;
-    particles.emplace_back(Eigen::Vector3d(0, 0, 0));
-    particles.emplace_back(Eigen::Vector3d(0, 0, 1));
-    particles.emplace_back(Eigen::Vector3d(1, 0, 0.5));
-    particles.emplace_back(Eigen::Vector3d(-1, 0, 0.5));
+    ParticleStore particles;
+    particles.add(Particle(Vec3(0, 0, 0)));
+    particles.add(Particle(Vec3(0, 0, 1)));
+    particles.add(Particle(Vec3(1, 0, 0.5)));
+    particles.add(Particle(Vec3(-1, 0, 0.5)));
 
-    double currentAngle = calculateAngle(particles[0].getPosition(), particles[1].getPosition(),
-                                         particles[2].getPosition(), particles[3].getPosition());
+    double currentAngle = calculateAngle(particles.getPosition(0), particles.getPosition(1),
+                                         particles.getPosition(2), particles.getPosition(3));
 
-    Eigen::Vector3d oldPosC = particles[2].getPosition();
+    Vec3 oldPosC = particles.getPosition(2);
     
     BendingConstraint constraint(0, 1, 2, 3, currentAngle, 0.0);
     constraint.solve(particles, 0.01);
 
-    EXPECT_NEAR((particles[2].getPosition() - oldPosC).norm(), 0.0, 1e-6);
+    EXPECT_NEAR((particles.getPosition(2) - oldPosC).norm(), 0.0, 1e-6);
 }
\ No newline at end of file
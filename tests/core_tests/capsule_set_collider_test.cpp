@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "physics/CapsuleCollider.hpp"
+#include "physics/CapsuleSetCollider.hpp"
+#include "physics/ParticleStore.hpp"
+#include <Eigen/Geometry>
+#include <cmath>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+Mat4 translation(const Vec3& offset) {
+    Mat4 m = Mat4::Identity();
+    m.topRightCorner<3, 1>() = offset;
+    return m;
+}
+
+}
+
+TEST(CapsuleSetColliderTest, BonesPlaceTheCapsules) {
+    CapsuleSetCollider set(0.0);
+    set.addCapsule(0, 0.1, Vec3(0.0, 0.0, 0.0), Vec3(0.0, 1.0, 0.0));
+    set.addCapsule(2, 0.2, Vec3(0.0, 0.0, 0.0), Vec3(1.0, 0.0, 0.0));
+    EXPECT_EQ(set.getBoneCount(), 3);
+
+    Mat4 turn = Mat4::Identity();
+    turn.topLeftCorner<3, 3>() = Eigen::AngleAxis<Scalar>(M_PI / 2, Vec3::UnitZ()).toRotationMatrix();
+    turn.topRightCorner<3, 1>() = Vec3(0.0, 0.0, 1.0);
+    set.setBoneTransforms({ translation(Vec3(1.0, 0.0, 0.0)), Mat4::Identity(), turn });
+
+    EXPECT_TRUE(set.getStarts()[0].isApprox(Vec3(1.0, 0.0, 0.0)));
+    EXPECT_TRUE(set.getEnds()[0].isApprox(Vec3(1.0, 1.0, 0.0)));
+    EXPECT_TRUE(set.getEnds()[1].isApprox(Vec3(0.0, 1.0, 1.0)));
+
+    // Too few matrices leave the pose alone.
+    set.setBoneTransforms({ Mat4::Identity() });
+    EXPECT_TRUE(set.getStarts()[0].isApprox(Vec3(1.0, 0.0, 0.0)));
+}
+
+TEST(CapsuleSetColliderTest, MatchesSeparateCapsulesWhenApart) {
+    CapsuleSetCollider set(0.0);
+    std::vector<CapsuleCollider> capsules;
+    for (int k = 0; k < 24; ++k) {
+        const Vec3 start(0.5 * (k % 6), 0.0, 0.5 * (k / 6));
+        const Vec3 end = start + Vec3(0.1, 0.3, 0.05);
+        const Scalar radius = 0.08 + 0.01 * (k % 3);
+        set.addCapsule(k, radius, Vec3::Zero(), end - start);
+        capsules.emplace_back(radius, start, end, 0.0);
+    }
+
+    std::vector<Mat4> bones;
+    for (int k = 0; k < 24; ++k)
+        bones.push_back(translation(capsules[k].getStart()));
+    set.setBoneTransforms(bones);
+
+    ParticleStore fromSet, fromCapsules;
+    for (int i = 0; i < 400; ++i) {
+        const Vec3 p(0.0075 * i, 0.15 + 0.05 * std::sin(0.3 * i), 0.005 * i);
+        fromSet.add(Particle(p));
+        fromCapsules.add(Particle(p));
+    }
+
+    const Scalar thickness = 0.02;
+    set.resolve(fromSet, 0.01, thickness);
+    for (auto& capsule : capsules)
+        capsule.resolve(fromCapsules, 0.01, thickness);
+
+    int moved = 0;
+    for (int i = 0; i < fromSet.size(); ++i) {
+        EXPECT_TRUE(fromSet.getPosition(i).isApprox(fromCapsules.getPosition(i), 1e-9)) << "particle " << i;
+        if (fromSet.getPosition(i) != fromSet.getOldPosition(i)) ++moved;
+    }
+    EXPECT_GT(moved, 0);
+}
+
+TEST(CapsuleSetColliderTest, PushesOutOfTheDeepestOverlap) {
+    CapsuleSetCollider set(0.0);
+    set.addCapsule(0, 0.5, Vec3(0.0, 0.0, 0.0), Vec3(0.0, 0.0, 0.0));
+    set.addCapsule(0, 0.2, Vec3(0.4, 0.0, 0.0), Vec3(0.4, 0.0, 0.0));
+
+    ParticleStore store;
+    int id = store.add(Particle(Vec3(0.3, 0.0, 0.0)));
+    set.resolve(store, 0.01, 0.0);
+
+    // 0.2 deep in the big sphere, 0.1 deep in the small one.
+    EXPECT_TRUE(store.getPosition(id).isApprox(Vec3(0.5, 0.0, 0.0)));
+}
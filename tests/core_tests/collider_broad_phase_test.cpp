@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+#include "physics/Solver.hpp"
+#include "engine/World.hpp"
+#include "physics/CapsuleCollider.hpp"
+#include "physics/GravityForce.hpp"
+#include "solver_test_scenes.hpp"
+#include <memory>
+#include <vector>
+
+using namespace ClothSDK;
+
+TEST(ColliderBroadPhaseTest, MatchesFullPasses) {
+    auto run = [](bool broadPhase) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(4);
+        solver.setColliderBroadPhase(broadPhase);
+
+        SolverTestScenes::addGridCloth(world, solver, 16, 16, 0.05);
+        world.addForce(std::make_shared<GravityForce>(Vec3(0.0, -9.81, 0.0)));
+
+        world.addPlaneCollider(Vec3(0.0, -0.6, 0.0), Vec3(0.0, 1.0, 0.0), 0.5);
+        world.addSphereCollider(Vec3(0.2, -0.3, 0.1), 0.15, 0.5);
+        for (int k = 0; k < 6; ++k) {
+            const Scalar z = -0.2 + 0.12 * k;
+            world.addCollider(std::make_shared<CapsuleCollider>(0.05, Vec3(-0.1, -0.25, z), Vec3(0.6, -0.2, z), 0.3));
+        }
+
+        for (int frame = 0; frame < 20; ++frame)
+            solver.update(world, 1.0 / 60.0);
+        return solver.getParticleStore().getPositions();
+    };
+
+    std::vector<Vec3> full = run(false);
+    std::vector<Vec3> culled = run(true);
+    ASSERT_EQ(full.size(), culled.size());
+    for (size_t i = 0; i < full.size(); ++i)
+        EXPECT_EQ(full[i], culled[i]) << "particle " << i;
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "physics/Solver.hpp"
+#include "engine/World.hpp"
+#include <memory>
+
+using namespace ClothSDK;
+
+namespace {
+
+class FloorConstraint : public Constraint {
+public:
+    FloorConstraint(int id, int* calls) : m_id(id), m_calls(calls) {}
+
+    void solve(ParticleStore& particles, Scalar dt) override {
+        ++(*m_calls);
+        Vec3 p = particles.getPosition(m_id);
+        if (p.y() < 0.0) {
+            p.y() = 0.0;
+            particles.setPosition(m_id, p);
+        }
+    }
+
+    void getParticleIds(std::vector<int>& outIds) const override { outIds.push_back(m_id); }
+
+private:
+    int m_id;
+    int* m_calls;
+};
+
+}
+
+TEST(ConstraintBucketsTest, CustomConstraintRunsThroughPluginPath) {
+    World world;
+
+    Solver solver;
+    solver.setSubsteps(2);
+    solver.setIterations(3);
+    int id = solver.addParticle(Particle(Vec3(0.0, -1.0, 0.0)));
+
+    int calls = 0;
+    solver.addConstraint(std::make_unique<FloorConstraint>(id, &calls));
+    solver.update(world, 0.01);
+
+    EXPECT_EQ(calls, 6);
+    EXPECT_GE(solver.getParticleStore().getPosition(id).y(), 0.0);
+}
+
+TEST(ConstraintBucketsTest, BuiltInConstraintsAreBucketedByType) {
+    Solver solver;
+    int a = solver.addParticle(Particle(Vec3(0.0, 0.0, 0.0)));
+    int b = solver.addParticle(Particle(Vec3(1.0, 0.0, 0.0)));
+    int c = solver.addParticle(Particle(Vec3(0.0, 1.0, 0.0)));
+    int d = solver.addParticle(Particle(Vec3(1.0, 1.0, 0.1)));
+
+    solver.addDistanceConstraint(a, b, 0.0);
+    solver.addDistanceConstraint(b, c, 0.0);
+    solver.addBendingConstraint(a, d, b, c, 0.0, 0.0);
+    solver.addPin(a, Vec3::Zero());
+
+    EXPECT_EQ(solver.getDistanceConstraints().size(), 2);
+    EXPECT_EQ(solver.getBendingConstraints().size(), 1);
+    EXPECT_EQ(solver.getPinConstraints().size(), 1);
+    EXPECT_DOUBLE_EQ(solver.getDistanceConstraints()[0].restLength, 1.0);
+}
+
+TEST(ConstraintBucketsTest, ColoredAndSequentialModesAgreeOnSingleChain) {
+    auto run = [](ConstraintSolveMode mode) {
+        World world;
+        Solver solver;
+        solver.setConstraintSolveMode(mode);
+        for (int i = 0; i < 6; ++i)
+            solver.addParticle(Particle(Vec3(i * 0.1, 0.0, 0.0)));
+        solver.addDistanceConstraint(0, 1, 0.0);
+        solver.addPin(0, Vec3::Zero());
+        solver.update(world, 0.01);
+        return solver.getParticleStore().getPosition(1);
+    };
+
+    Vec3 colored = run(ConstraintSolveMode::Colored);
+    Vec3 sequential = run(ConstraintSolveMode::Sequential);
+    EXPECT_NEAR((colored - sequential).norm(), 0.0, 1e-12);
+
+    // Coloring is opt-in, so existing scenes keep their Gauss-Seidel order.
+    EXPECT_EQ(Solver().getConstraintSolveMode(), ConstraintSolveMode::Sequential);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "physics/ConstraintColoring.hpp"
+#include <set>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+void buildChain(int particleCount, std::vector<int>& offsets, std::vector<int>& ids) {
+    offsets = { 0 };
+    for (int i = 0; i + 1 < particleCount; ++i) {
+        ids.push_back(i);
+        ids.push_back(i + 1);
+        offsets.push_back(static_cast<int>(ids.size()));
+    }
+}
+
+}
+
+TEST(ConstraintColoringTest, ChainNeedsTwoColors) {
+    std::vector<int> offsets, ids, colors;
+    buildChain(10, offsets, ids);
+
+    int batches = ConstraintColoring::colorize(10, offsets, ids, colors);
+
+    EXPECT_EQ(batches, 2);
+    for (size_t i = 0; i + 1 < colors.size(); ++i)
+        EXPECT_NE(colors[i], colors[i + 1]);
+}
+
+TEST(ConstraintColoringTest, BatchesShareNoParticles) {
+    const int rows = 8, cols = 8;
+    std::vector<int> offsets = { 0 }, ids, colors;
+    auto id = [&](int r, int c) { return r * cols + c; };
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            if (c + 1 < cols) { ids.push_back(id(r, c)); ids.push_back(id(r, c + 1)); offsets.push_back(ids.size()); }
+            if (r + 1 < rows) { ids.push_back(id(r, c)); ids.push_back(id(r + 1, c)); offsets.push_back(ids.size()); }
+            if (r + 1 < rows && c + 1 < cols) {
+                ids.insert(ids.end(), { id(r, c), id(r + 1, c + 1), id(r, c + 1), id(r + 1, c) });
+                offsets.push_back(ids.size());
+            }
+        }
+    }
+
+    ConstraintColoring::colorize(rows * cols, offsets, ids, colors);
+
+    std::vector<int> order, batchOffsets, batchColors;
+    ConstraintColoring::buildBatches(colors, order, batchOffsets, batchColors);
+
+    ASSERT_EQ(order.size(), colors.size());
+    for (size_t b = 0; b < batchColors.size(); ++b) {
+        std::set<int> touched;
+        for (int k = batchOffsets[b]; k < batchOffsets[b + 1]; ++k) {
+            int constraint = order[k];
+            EXPECT_EQ(colors[constraint], batchColors[b]);
+            for (int p = offsets[constraint]; p < offsets[constraint + 1]; ++p)
+                EXPECT_TRUE(touched.insert(ids[p]).second);
+        }
+    }
+}
+
+TEST(ConstraintColoringTest, EmptyFootprintGoesToOverflowBatch) {
+    std::vector<int> offsets = { 0, 2, 2 };
+    std::vector<int> ids = { 0, 1 };
+    std::vector<int> colors;
+
+    int batches = ConstraintColoring::colorize(2, offsets, ids, colors);
+
+    EXPECT_EQ(batches, 2);
+    EXPECT_EQ(colors[0], 0);
+    EXPECT_EQ(colors[1], ConstraintColoring::MaxColors);
+
+    std::vector<int> order, batchOffsets, batchColors;
+    ConstraintColoring::buildBatches(colors, order, batchOffsets, batchColors);
+    EXPECT_EQ(batchColors.back(), ConstraintColoring::MaxColors);
+    EXPECT_EQ(order.back(), 1);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include "physics/ContinuousCollision.hpp"
+#include "solver_test_scenes.hpp"
+
+using namespace ClothSDK;
+
+TEST(ContinuousCollisionTest, CubicRootsAreSortedAndInRange) {
+    // (t - 0.2)(t - 0.5)(t - 0.9) = t^3 - 1.6 t^2 + 0.73 t - 0.09
+    Scalar roots[3];
+    ASSERT_EQ(ContinuousCollision::solveCubic(-0.09, 0.73, -1.6, 1.0, roots), 3);
+    EXPECT_NEAR(roots[0], 0.2, 1e-5);
+    EXPECT_NEAR(roots[1], 0.5, 1e-5);
+    EXPECT_NEAR(roots[2], 0.9, 1e-5);
+
+    // Single root at 2, outside the substep.
+    EXPECT_EQ(ContinuousCollision::solveCubic(-2.0, 1.0, 0.0, 0.0, roots), 0);
+}
+
+TEST(ContinuousCollisionTest, VertexPassingThroughTriangle) {
+    const Vec3 a(0.0, 0.0, 0.0), b(1.0, 0.0, 0.0), c(0.0, 0.0, 1.0);
+    Scalar time;
+    Vec3 bary;
+
+    ASSERT_TRUE(ContinuousCollision::vertexTriangle(Vec3(0.25, 0.1, 0.25), Vec3(0.25, -0.3, 0.25),
+                                                    a, a, b, b, c, c, 1e-6, time, bary));
+    EXPECT_NEAR(time, 0.25, 1e-5);
+    EXPECT_NEAR(bary.y(), 0.25, 1e-5);
+    EXPECT_NEAR(bary.z(), 0.25, 1e-5);
+
+    // Same motion beside the triangle.
+    EXPECT_FALSE(ContinuousCollision::vertexTriangle(Vec3(1.25, 0.1, 1.25), Vec3(1.25, -0.3, 1.25),
+                                                     a, a, b, b, c, c, 1e-6, time, bary));
+}
+
+TEST(ContinuousCollisionTest, CrossingEdges) {
+    // Edge along x at y = 0; a second edge along z sweeps down through it.
+    const Vec3 a(-1.0, 0.0, 0.0), b(1.0, 0.0, 0.0);
+    Scalar time, s, t;
+
+    ASSERT_TRUE(ContinuousCollision::edgeEdge(a, a, b, b,
+                                              Vec3(0.5, 0.2, -1.0), Vec3(0.5, -0.2, -1.0),
+                                              Vec3(0.5, 0.2, 1.0), Vec3(0.5, -0.2, 1.0),
+                                              1e-6, time, s, t));
+    EXPECT_NEAR(time, 0.5, 1e-5);
+    EXPECT_NEAR(s, 0.75, 1e-5);
+    EXPECT_NEAR(t, 0.5, 1e-5);
+
+    EXPECT_FALSE(ContinuousCollision::edgeEdge(a, a, b, b,
+                                               Vec3(1.5, 0.2, -1.0), Vec3(1.5, -0.2, -1.0),
+                                               Vec3(1.5, 0.2, 1.0), Vec3(1.5, -0.2, 1.0),
+                                               1e-6, time, s, t));
+}
+
+TEST(ContinuousCollisionTest, SolverStopsTunnelling) {
+    auto run = [](bool continuous, int* impacts) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(1);
+        solver.setContinuousCollision(continuous);
+        SolverTestScenes::addStaticTriangle(world, solver);
+
+        // Moves 0.196 down in one substep, straight through the triangle interior.
+        Particle bullet(Vec3(0.25, 0.05, 0.25));
+        bullet.setOldPosition(Vec3(0.25, 0.25, 0.25));
+        int p = solver.addParticle(bullet);
+
+        solver.update(world, 0.001);
+        if (impacts) *impacts = solver.getContinuousImpactCount();
+        return solver.getParticleStore().getPosition(p).y();
+    };
+
+    int impacts = 0;
+    EXPECT_LT(run(false, nullptr), -0.1);
+    EXPECT_GT(run(true, &impacts), 0.0);
+    EXPECT_EQ(impacts, 1);
+}
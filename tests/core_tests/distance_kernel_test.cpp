@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "physics/DistanceKernel.hpp"
+#include "physics/ParticleStore.hpp"
+#include <type_traits>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+// Independent pairs (2k, 2k+1) with a mix of stretched, compressed, pinned and degenerate cases.
+void buildPairs(int pairCount, ParticleStore& particles, std::vector<DistanceConstraint>& constraints) {
+    for (int k = 0; k < pairCount; ++k) {
+        double offset = static_cast<double>(k);
+        double length = 0.5 + 0.1 * (k % 7);
+        if (k % 11 == 5) length = 0.0;
+
+        int a = particles.add(Particle(Vec3(offset, 0.3 * k, -0.2 * k)));
+        int b = particles.add(Particle(Vec3(offset + length, 0.3 * k + 0.05 * (k % 3), -0.2 * k)));
+
+        if (k % 5 == 2) particles.setInverseMass(a, 0.0);
+        if (k % 13 == 4) {
+            particles.setInverseMass(a, 0.0);
+            particles.setInverseMass(b, 0.0);
+        }
+
+        DistanceConstraint constraint(a, b, 1.0, (k % 2) ? 1e-6 : 0.0);
+        constraint.lambda = 0.01 * (k % 4);
+        constraints.push_back(constraint);
+    }
+}
+
+}
+
+TEST(DistanceKernelTest, DetectedLevelIsSupported) {
+    EXPECT_TRUE(DistanceKernel::isSupported(SimdLevel::Scalar));
+    EXPECT_TRUE(DistanceKernel::isSupported(DistanceKernel::detect()));
+}
+
+TEST(DistanceKernelTest, VectorPathsMatchScalar) {
+    const int pairCount = 37;
+    const double dt = 1.0 / 900.0;
+    const double tolerance = std::is_same<Scalar, float>::value ? 1e-5 : 1e-12;
+
+    ParticleStore reference;
+    std::vector<DistanceConstraint> referenceConstraints;
+    buildPairs(pairCount, reference, referenceConstraints);
+    ConstraintResidual referenceResidual;
+    DistanceKernel::solveBatch(referenceConstraints.data(), pairCount, reference, dt, SimdLevel::Scalar, &referenceResidual);
+    EXPECT_GT(referenceResidual.count, 0);
+    EXPECT_LT(referenceResidual.count, pairCount);
+
+    for (SimdLevel level : { SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512 }) {
+        if (!DistanceKernel::isSupported(level)) continue;
+        SCOPED_TRACE(DistanceKernel::toString(level));
+
+        ParticleStore particles;
+        std::vector<DistanceConstraint> constraints;
+        buildPairs(pairCount, particles, constraints);
+        ConstraintResidual residual;
+        DistanceKernel::solveBatch(constraints.data(), pairCount, particles, dt, level, &residual);
+
+        for (int i = 0; i < particles.size(); ++i) {
+            EXPECT_NEAR((particles.getPosition(i) - reference.getPosition(i)).norm(), 0.0, tolerance);
+        }
+        for (int k = 0; k < pairCount; ++k) {
+            EXPECT_NEAR(constraints[k].lambda, referenceConstraints[k].lambda, tolerance);
+        }
+
+        // Every lane reports the error it corrected, skipping the ones the scalar path skips.
+        EXPECT_EQ(residual.count, referenceResidual.count);
+        EXPECT_NEAR(residual.max, referenceResidual.max, tolerance);
+        EXPECT_NEAR(residual.sumSq, referenceResidual.sumSq, tolerance);
+    }
+}
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include "physics/Solver.hpp"
+#include "engine/World.hpp"
+
+using namespace ClothSDK;
+
+TEST(HashRebuildPolicyTest, BuildCountsFollowPolicy) {
+    auto countBuilds = [](HashRebuildPolicy policy, const Vec3& velocity) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(4);
+        solver.setHashRebuildPolicy(policy);
+        solver.setHashRebuildInterval(2);
+        solver.setHashRebuildDisplacement(0.25);
+
+        Particle particle(Vec3::Zero());
+        particle.setOldPosition(-velocity);
+        solver.addParticle(particle);
+        solver.addParticle(Particle(Vec3(1.0, 0.0, 0.0)));
+
+        solver.update(world, 0.01);
+        solver.update(world, 0.01);
+        return solver.getHashBuildCount();
+    };
+
+    const Vec3 still = Vec3::Zero();
+    const Vec3 fast = Vec3(0.004, 0.0, 0.0);
+    EXPECT_EQ(countBuilds(HashRebuildPolicy::PerFrame, still), 2);
+    EXPECT_EQ(countBuilds(HashRebuildPolicy::EverySubstep, still), 9);
+    EXPECT_EQ(countBuilds(HashRebuildPolicy::EveryNSubsteps, still), 5);
+    EXPECT_EQ(countBuilds(HashRebuildPolicy::Displacement, still), 1);
+    EXPECT_GT(countBuilds(HashRebuildPolicy::Displacement, fast), 1);
+}
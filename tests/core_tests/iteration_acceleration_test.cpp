@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include "physics/Solver.hpp"
+#include "engine/World.hpp"
+#include "physics/GravityForce.hpp"
+#include "solver_test_scenes.hpp"
+#include <memory>
+
+using namespace ClothSDK;
+
+TEST(IterationAccelerationTest, ReducesStretch) {
+    auto run = [](ConstraintSolveMode mode, IterationAcceleration acceleration, Scalar omega) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(2);
+        solver.setIterations(6);
+        solver.setConstraintSolveMode(mode);
+        solver.setIterationAcceleration(acceleration);
+        solver.setOverRelaxation(omega);
+
+        // Stiff hanging chain, pinned at the top.
+        for (int i = 0; i < 30; ++i)
+            solver.addParticle(Particle(Vec3(0.0, -0.05 * i, 0.0)));
+        solver.setParticleInverseMass(0, 0.0);
+        for (int i = 0; i + 1 < 30; ++i)
+            solver.addDistanceConstraint(i, i + 1, 0.0);
+        world.addForce(std::make_shared<GravityForce>(world.getGravity()));
+
+        for (int frame = 0; frame < 10; ++frame)
+            solver.update(world, 1.0 / 60.0);
+
+        const ParticleStore& store = solver.getParticleStore();
+        return (store.getPosition(29) - store.getPosition(0)).norm() - 0.05 * 29;
+    };
+
+    const double tolerance = SolverTestScenes::tolerance(1e-6, 1e-9);
+    for (ConstraintSolveMode mode : { ConstraintSolveMode::Sequential, ConstraintSolveMode::Colored }) {
+        const Scalar plain = run(mode, IterationAcceleration::None, 1.0);
+        EXPECT_GT(plain, 0.0);
+
+        // Omega 1 is the plain iteration.
+        EXPECT_NEAR(run(mode, IterationAcceleration::OverRelaxation, 1.0), plain, tolerance);
+
+        EXPECT_LT(run(mode, IterationAcceleration::OverRelaxation, 1.5), plain);
+        EXPECT_LT(run(mode, IterationAcceleration::Chebyshev, 1.0), plain);
+    }
+}
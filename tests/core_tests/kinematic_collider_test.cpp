@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "physics/CapsuleCollider.hpp"
+#include "physics/MeshCollider.hpp"
+#include "physics/ParticleStore.hpp"
+#include "physics/Solver.hpp"
+#include "physics/SphereCollider.hpp"
+#include "engine/World.hpp"
+#include <Eigen/Geometry>
+#include <cmath>
+#include <memory>
+
+using namespace ClothSDK;
+
+TEST(KinematicColliderTest, SphereInterpolatesTowardsItsTarget) {
+    SphereCollider sphere(Vec3(0.0, 0.0, 0.0), 0.5, 0.5);
+    sphere.setTargetCenter(Vec3(2.0, 0.0, 0.0));
+
+    sphere.setFrameTime(0.25);
+    EXPECT_TRUE(sphere.getCenter().isApprox(Vec3(0.5, 0.0, 0.0)));
+    sphere.setFrameTime(1.0);
+    EXPECT_TRUE(sphere.getCenter().isApprox(Vec3(2.0, 0.0, 0.0)));
+
+    // Without a new target the next frame keeps the sphere in place.
+    sphere.endFrame();
+    sphere.setFrameTime(0.5);
+    EXPECT_TRUE(sphere.getCenter().isApprox(Vec3(2.0, 0.0, 0.0)));
+}
+
+TEST(KinematicColliderTest, FrictionFollowsTheMovingSurface) {
+    SphereCollider sphere(Vec3(0.0, 0.0, 0.0), 1.0, 1.0);
+    sphere.setTargetCenter(Vec3(0.1, 0.0, 0.0));
+    sphere.setFrameTime(1.0);
+
+    // A particle resting on top of the sphere, slightly inside.
+    ParticleStore store;
+    int id = store.add(Particle(Vec3(0.1, 0.99, 0.0)));
+    store.getOldPositions()[id] = Vec3(0.1, 0.99, 0.0);
+
+    sphere.resolve(store, 0.01, 0.0);
+
+    // With full friction the particle is carried along with the surface.
+    const Vec3 velocity = store.getPosition(id) - store.getOldPosition(id);
+    EXPECT_NEAR(velocity.x(), 0.1, 1e-6);
+}
+
+TEST(KinematicColliderTest, MeshSlerpsItsRotation) {
+    std::vector<Vec3> vertices = { Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(0, 1, 0), Vec3(0, 0, 1) };
+    std::vector<Triangle> triangles = { { 0, 2, 1 }, { 0, 1, 3 }, { 0, 3, 2 }, { 1, 2, 3 } };
+    MeshCollider mesh(vertices, triangles, 0.5);
+
+    const Mat3 quarterTurn = Eigen::AngleAxis<Scalar>(M_PI / 2, Vec3::UnitZ()).toRotationMatrix();
+    mesh.setTargetTransform(quarterTurn, Vec3(0.0, 0.0, 2.0));
+    mesh.setFrameTime(0.5);
+
+    const Mat3 eighthTurn = Eigen::AngleAxis<Scalar>(M_PI / 4, Vec3::UnitZ()).toRotationMatrix();
+    EXPECT_TRUE(mesh.getRotation().isApprox(eighthTurn, 1e-6));
+    EXPECT_TRUE(mesh.getTranslation().isApprox(Vec3(0.0, 0.0, 1.0)));
+}
+
+TEST(KinematicColliderTest, SubstepInterpolationStopsCapsuleTunnelling) {
+    auto run = [](bool animated) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(20);
+        int id = solver.addParticle(Particle(Vec3(0.0, 0.0, 0.0)));
+
+        auto capsule = std::make_shared<CapsuleCollider>(0.1, Vec3(-1.0, -1.0, 0.0), Vec3(-1.0, 1.0, 0.0), 0.0);
+        world.addCollider(capsule);
+
+        // The capsule crosses the particle within one frame.
+        if (animated)
+            capsule->setTargetPose(Vec3(1.0, -1.0, 0.0), Vec3(1.0, 1.0, 0.0));
+        else
+            capsule->setPose(Vec3(1.0, -1.0, 0.0), Vec3(1.0, 1.0, 0.0));
+
+        solver.update(world, 1.0 / 60.0);
+        return solver.getParticleStore().getPosition(id).x();
+    };
+
+    EXPECT_NEAR(run(false), 0.0, 1e-9);
+    EXPECT_GT(run(true), 1.0);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "physics/MeshCollider.hpp"
+#include "physics/ParticleStore.hpp"
+#include <Eigen/Geometry>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+// Unit cube with outward counter-clockwise faces.
+void buildCube(std::vector<Vec3>& vertices, std::vector<Triangle>& triangles) {
+    for (int k = 0; k < 8; ++k)
+        vertices.emplace_back(k & 1, (k >> 1) & 1, (k >> 2) & 1);
+
+    const int quads[6][4] = {
+        { 0, 2, 3, 1 }, { 4, 5, 7, 6 },     // z = 0, z = 1
+        { 0, 1, 5, 4 }, { 2, 6, 7, 3 },     // y = 0, y = 1
+        { 0, 4, 6, 2 }, { 1, 3, 7, 5 },     // x = 0, x = 1
+    };
+    for (const auto& q : quads) {
+        triangles.emplace_back(q[0], q[1], q[2]);
+        triangles.emplace_back(q[0], q[2], q[3]);
+    }
+}
+
+int addMoving(ParticleStore& store, const Vec3& from, const Vec3& to) {
+    int id = store.add(Particle(to));
+    store.getOldPositions()[id] = from;
+    return id;
+}
+
+}
+
+TEST(MeshColliderTest, PushesParticlesOutOfTheClosestFace) {
+    std::vector<Vec3> vertices;
+    std::vector<Triangle> triangles;
+    buildCube(vertices, triangles);
+    MeshCollider collider(vertices, triangles, 0.0);
+
+    ParticleStore store;
+    int top = addMoving(store, Vec3(0.5, 1.2, 0.5), Vec3(0.5, 0.9, 0.5));
+    int side = addMoving(store, Vec3(-0.1, 0.3, 0.4), Vec3(0.02, 0.3, 0.4));
+    int near = addMoving(store, Vec3(0.5, 0.5, 1.2), Vec3(0.5, 0.5, 1.03));
+    int far = addMoving(store, Vec3(3.0, 3.0, 3.0), Vec3(3.0, 3.0, 3.0));
+
+    const Scalar thickness = 0.05;
+    collider.resolve(store, 0.01, thickness);
+
+    EXPECT_NEAR(store.getPosition(top).y(), 1.0 + thickness, 1e-6);
+    EXPECT_NEAR(store.getPosition(side).x(), -thickness, 1e-6);
+    EXPECT_NEAR(store.getPosition(near).z(), 1.0 + thickness, 1e-6);
+    EXPECT_TRUE(store.getPosition(far).isApprox(Vec3(3.0, 3.0, 3.0)));
+
+    // Without friction the projection leaves the tangential motion alone.
+    EXPECT_NEAR(store.getPosition(side).y() - store.getOldPosition(side).y(), 0.0, 1e-6);
+    EXPECT_NEAR(store.getPosition(top).x() - store.getOldPosition(top).x(), 0.0, 1e-6);
+}
+
+TEST(MeshColliderTest, InwardWindingIsFlipped) {
+    std::vector<Vec3> vertices;
+    std::vector<Triangle> triangles;
+    buildCube(vertices, triangles);
+    for (Triangle& tri : triangles) std::swap(tri.b, tri.c);
+    MeshCollider collider(vertices, triangles, 0.5);
+
+    ParticleStore store;
+    int id = addMoving(store, Vec3(0.5, 1.2, 0.5), Vec3(0.5, 0.95, 0.5));
+    collider.resolve(store, 0.01, 0.05);
+    EXPECT_NEAR(store.getPosition(id).y(), 1.05, 1e-6);
+}
+
+TEST(MeshColliderTest, RigidTransformMovesTheSurface) {
+    std::vector<Vec3> vertices;
+    std::vector<Triangle> triangles;
+    buildCube(vertices, triangles);
+    MeshCollider collider(vertices, triangles, 0.0);
+
+    // Rotating a quarter turn about z maps the local +y face to world -x.
+    const Mat3 rotation = Eigen::AngleAxis<Scalar>(0.5 * M_PI, Vec3::UnitZ()).toRotationMatrix();
+    collider.setTransform(rotation, Vec3(5.0, 0.0, 0.0));
+
+    ParticleStore store;
+    int id = addMoving(store, Vec3(3.8, 0.5, 0.5), Vec3(4.1, 0.5, 0.5));
+    int untouched = addMoving(store, Vec3(0.5, 0.9, 0.5), Vec3(0.5, 0.9, 0.5));
+    collider.resolve(store, 0.01, 0.05);
+
+    EXPECT_NEAR(store.getPosition(id).x(), 4.0 - 0.05, 1e-6);
+    EXPECT_NEAR(store.getPosition(id).y(), 0.5, 1e-6);
+    EXPECT_TRUE(store.getPosition(untouched).isApprox(Vec3(0.5, 0.9, 0.5)));
+}
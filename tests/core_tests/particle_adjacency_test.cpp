@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include "physics/ParticleAdjacency.hpp"
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+// Chain 0 - 1 - 2 - 3 - 4 with a repeated edge.
+ParticleAdjacency buildChain(int rings) {
+    ParticleAdjacency adjacency;
+    adjacency.addEdge(0, 1);
+    adjacency.addEdge(1, 2);
+    adjacency.addEdge(2, 1);
+    adjacency.addEdge(2, 3);
+    adjacency.addEdge(3, 4);
+    adjacency.build(5, rings);
+    return adjacency;
+}
+
+}
+
+TEST(ParticleAdjacencyTest, DirectNeighborsAreSortedAndUnique) {
+    ParticleAdjacency adjacency = buildChain(1);
+
+    const std::vector<int>& offsets = adjacency.getOffsets();
+    const std::vector<int>& neighbors = adjacency.getNeighbors();
+    ASSERT_EQ(offsets.size(), 6);
+    EXPECT_EQ(std::vector<int>(neighbors.begin() + offsets[2], neighbors.begin() + offsets[3]), (std::vector<int>{ 1, 3 }));
+
+    EXPECT_TRUE(adjacency.contains(0, 1));
+    EXPECT_TRUE(adjacency.contains(1, 0));
+    EXPECT_FALSE(adjacency.contains(0, 2));
+    EXPECT_FALSE(adjacency.contains(2, 2));
+}
+
+TEST(ParticleAdjacencyTest, TwoRingIncludesNeighborsOfNeighbors) {
+    ParticleAdjacency adjacency = buildChain(2);
+
+    EXPECT_TRUE(adjacency.contains(0, 2));
+    EXPECT_TRUE(adjacency.contains(2, 4));
+    EXPECT_TRUE(adjacency.contains(2, 0));
+    EXPECT_FALSE(adjacency.contains(0, 3));
+    EXPECT_FALSE(adjacency.contains(1, 1));
+}
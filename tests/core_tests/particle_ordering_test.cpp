@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include "physics/ParticleAdjacency.hpp"
+#include "physics/ParticleOrdering.hpp"
+#include "physics/AerodynamicForce.hpp"
+#include "physics/GravityForce.hpp"
+#include "solver_test_scenes.hpp"
+#include <algorithm>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+// Grid graph of rows x cols particles whose indices are scrambled by a fixed stride.
+ParticleAdjacency buildScrambledGrid(int rows, int cols) {
+    const int count = rows * cols;
+    auto id = [&](int r, int c) { return ((r * cols + c) * 37) % count; };
+
+    ParticleAdjacency adjacency;
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            if (c + 1 < cols) adjacency.addEdge(id(r, c), id(r, c + 1));
+            if (r + 1 < rows) adjacency.addEdge(id(r, c), id(r + 1, c));
+        }
+    }
+    adjacency.build(count, 1);
+    return adjacency;
+}
+
+bool isPermutation(std::vector<int> order, int count) {
+    std::sort(order.begin(), order.end());
+    for (int k = 0; k < count; ++k)
+        if (order[k] != k) return false;
+    return static_cast<int>(order.size()) == count;
+}
+
+}
+
+TEST(ParticleOrderingTest, ReverseCuthillMcKeeReducesBandwidth) {
+    const int rows = 12;
+    const int cols = 10;
+    ParticleAdjacency scrambled = buildScrambledGrid(rows, cols);
+
+    std::vector<int> order;
+    ParticleOrdering::reverseCuthillMcKee(scrambled.getOffsets(), scrambled.getNeighbors(), order);
+    ASSERT_TRUE(isPermutation(order, rows * cols));
+
+    std::vector<int> newIndex;
+    ParticleOrdering::invert(order, newIndex);
+    ParticleAdjacency reordered = scrambled;
+    reordered.remap(newIndex);
+    reordered.build(rows * cols, 1);
+
+    const int before = ParticleOrdering::bandwidth(scrambled.getOffsets(), scrambled.getNeighbors());
+    const int after = ParticleOrdering::bandwidth(reordered.getOffsets(), reordered.getNeighbors());
+    EXPECT_LE(after, std::min(rows, cols) + 1);
+    EXPECT_LT(after, before);
+}
+
+TEST(ParticleOrderingTest, MortonOrderGroupsQuadrants) {
+    // 4x4 grid stored in reverse order: the first Morton quadrant is the 2x2 block at the origin.
+    std::vector<Vec3> positions;
+    for (int i = 15; i >= 0; --i)
+        positions.emplace_back(i % 4, i / 4, 0.0);
+
+    std::vector<int> order;
+    ParticleOrdering::mortonOrder(positions, order);
+    ASSERT_TRUE(isPermutation(order, 16));
+
+    for (int k = 0; k < 4; ++k) {
+        EXPECT_LT(positions[order[k]].x(), 2.0);
+        EXPECT_LT(positions[order[k]].y(), 2.0);
+    }
+    EXPECT_EQ(positions[order[0]], Vec3::Zero());
+}
+
+TEST(ParticleOrderingTest, ReorderingKeepsClothResultsByExternalId) {
+    auto run = [](bool reorder, ParticleOrderingMethod method) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(4);
+        solver.setConstraintSolveMode(ConstraintSolveMode::Sequential);
+
+        auto cloth = SolverTestScenes::addGridCloth(world, solver, 8, 6, 0.05);
+        SolverTestScenes::pinInPlace(solver, cloth->getParticleID(7, 0));
+        world.addForce(std::make_shared<GravityForce>(world.getGravity()));
+        world.addForce(std::make_shared<AerodynamicForce>(cloth->getAeroFaces(), Vec3(1.0, 0.0, 0.5), 1.2));
+
+        if (reorder) {
+            solver.reorderParticles(world, method);
+            for (int id = 0; id < solver.getParticleCount(); ++id)
+                EXPECT_EQ(solver.getExternalIndex(solver.getInternalIndex(id)), id);
+        }
+
+        solver.update(world, 0.01);
+        solver.update(world, 0.01);
+
+        std::vector<Vec3> positions;
+        for (int id : cloth->getParticleIndices())
+            positions.push_back(solver.getParticleStore().getPosition(id));
+        return positions;
+    };
+
+    const double tolerance = SolverTestScenes::tolerance(1e-5, 1e-10);
+    std::vector<Vec3> reference = run(false, ParticleOrderingMethod::Morton);
+
+    for (ParticleOrderingMethod method : { ParticleOrderingMethod::Morton, ParticleOrderingMethod::ReverseCuthillMcKee }) {
+        std::vector<Vec3> reordered = run(true, method);
+        ASSERT_EQ(reordered.size(), reference.size());
+        for (size_t i = 0; i < reference.size(); ++i)
+            EXPECT_NEAR((reference[i] - reordered[i]).norm(), 0.0, tolerance);
+    }
+}
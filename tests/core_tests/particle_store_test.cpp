@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include "physics/ParticleStore.hpp"
+#include <Eigen/Dense>
+
+using namespace ClothSDK;
+
+TEST(ParticleStoreTest, AddKeepsAttributesContiguous) {
+    ParticleStore store;
+    Particle p(Vec3(1.0, 2.0, 3.0));
+    p.setInverseMass(0.5);
+
+    int a = store.add(Particle(Vec3::Zero()));
+    int b = store.add(p);
+
+    EXPECT_EQ(a, 0);
+    EXPECT_EQ(b, 1);
+    EXPECT_EQ(store.size(), 2);
+    EXPECT_EQ(&store.getPositions()[1], &store.getPositions()[0] + 1);
+    EXPECT_DOUBLE_EQ(store.getPosition(1).z(), 3.0);
+    EXPECT_DOUBLE_EQ(store.getInverseMass(1), 0.5);
+}
+
+TEST(ParticleStoreTest, AddForceAndMassMatchParticle) {
+    ParticleStore store;
+    Particle reference(Vec3::Zero());
+    int id = store.add(reference);
+
+    store.addMass(id, 1.0);
+    reference.addMass(1.0);
+    store.addForce(id, Vec3(4.0, 0.0, 0.0));
+    reference.addForce(Vec3(4.0, 0.0, 0.0));
+
+    EXPECT_DOUBLE_EQ(store.getInverseMass(id), reference.getInverseMass());
+    EXPECT_DOUBLE_EQ(store.getAcceleration(id).x(), reference.getAcceleration().x());
+}
+
+TEST(ParticleStoreTest, ToParticlesRoundTrip) {
+    ParticleStore store;
+    store.add(Particle(Vec3(1.0, 0.0, 0.0)));
+    store.setOldPosition(0, Vec3(0.5, 0.0, 0.0));
+    store.setInverseMass(0, 0.0);
+
+    std::vector<Particle> particles;
+    store.toParticles(particles);
+
+    ASSERT_EQ(particles.size(), 1);
+    EXPECT_DOUBLE_EQ(particles[0].getPosition().x(), 1.0);
+    EXPECT_DOUBLE_EQ(particles[0].getOldPosition().x(), 0.5);
+    EXPECT_DOUBLE_EQ(particles[0].getInverseMass(), 0.0);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "physics/Particle.hpp"
 #include <Eigen/Dense>
+#include <type_traits>
 
 using namespace ClothSDK;
 
@@ -10,7 +11,7 @@ using namespace ClothSDK;
     EXPECT_NEAR(v1.z(), v2.z(), tol);
 
 TEST(ParticleTest, Initialization) {
-    Eigen::Vector3d pos(1.0, 2.0, 3.0);
+    Vec3 pos(1.0, 2.0, 3.0);
     Particle p(pos);
 
     EXPECT_VECTOR3D_NEAR(p.getPosition(), pos, 1e-9);
@@ -19,34 +20,35 @@ TEST(ParticleTest, Initialization) {
 }
 
 TEST(ParticleTest, AddForce) {
-    Particle p(Eigen::Vector3d::Zero());
+    Particle p(Vec3::Zero());
     p.setInverseMass(0.5); 
     
-    p.addForce(Eigen::Vector3d(10.0, 0.0, 0.0));
-    EXPECT_VECTOR3D_NEAR(p.getAcceleration(), Eigen::Vector3d(5.0, 0.0, 0.0), 1e-9);
+    p.addForce(Vec3(10.0, 0.0, 0.0));
+    EXPECT_VECTOR3D_NEAR(p.getAcceleration(), Vec3(5.0, 0.0, 0.0), 1e-9);
     
     p.clearForces();
-    EXPECT_VECTOR3D_NEAR(p.getAcceleration(), Eigen::Vector3d::Zero(), 1e-9);
+    EXPECT_VECTOR3D_NEAR(p.getAcceleration(), Vec3::Zero(), 1e-9);
 }
 
 TEST(ParticleTest, IntegrationMovement) {
-    Particle p(Eigen::Vector3d::Zero());
+    Particle p(Vec3::Zero());
     double dt = 0.1;
     
-    p.addForce(Eigen::Vector3d(10.0, 0.0, 0.0));
+    p.addForce(Vec3(10.0, 0.0, 0.0));
     
     p.integrate(dt);
     
-    EXPECT_NEAR(p.getPosition().x(), 0.1, 1e-9);
+    const double tolerance = std::is_same<Scalar, float>::value ? 1e-6 : 1e-9;
+    EXPECT_NEAR(p.getPosition().x(), 0.1, tolerance);
     EXPECT_NEAR(p.getOldPosition().x(), 0.0, 1e-9); 
 }
 
 TEST(ParticleTest, StaticParticle) {
-    Particle p(Eigen::Vector3d(1.0, 1.0, 1.0));
+    Particle p(Vec3(1.0, 1.0, 1.0));
     p.setInverseMass(0.0); 
     
-    p.addForce(Eigen::Vector3d(0.0, -9.8, 0.0));
+    p.addForce(Vec3(0.0, -9.8, 0.0));
     p.integrate(0.1);
     
-    EXPECT_VECTOR3D_NEAR(p.getPosition(), Eigen::Vector3d(1.0, 1.0, 1.0), 1e-9);
+    EXPECT_VECTOR3D_NEAR(p.getPosition(), Vec3(1.0, 1.0, 1.0), 1e-9);
 }
\ No newline at end of file
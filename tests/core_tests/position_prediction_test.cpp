@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "physics/Solver.hpp"
+#include "engine/World.hpp"
+#include "physics/AerodynamicForce.hpp"
+#include "physics/GravityForce.hpp"
+#include "solver_test_scenes.hpp"
+#include <memory>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+// Gravity through the per-particle apply() path, for comparison with the fused one.
+class ScatteredGravity : public Force {
+public:
+    explicit ScatteredGravity(const Vec3& gravity) : m_gravity(gravity) {}
+
+    void apply(ParticleStore& particles, Scalar dt) override {
+        for (int i = 0; i < particles.size(); ++i)
+            if (particles.getInverseMass(i) != 0.0)
+                particles.addForce(i, m_gravity);
+    }
+
+private:
+    Vec3 m_gravity;
+};
+
+}
+
+TEST(PositionPredictionTest, UniformForcesAreFusedIntoPrediction) {
+    auto run = [](bool fused) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(4);
+
+        auto cloth = SolverTestScenes::addGridCloth(world, solver, 10, 8, 0.05);
+        SolverTestScenes::pinInPlace(solver, cloth->getParticleID(0, 0));
+        if (fused)
+            world.addForce(std::make_shared<GravityForce>(Vec3(0.0, -9.81, 0.0)));
+        else
+            world.addForce(std::make_shared<ScatteredGravity>(Vec3(0.0, -9.81, 0.0)));
+        world.addForce(std::make_shared<AerodynamicForce>(cloth->getAeroFaces(), Vec3(1.0, 0.0, 0.5), 1.2));
+
+        for (int frame = 0; frame < 5; ++frame)
+            solver.update(world, 0.01);
+        return solver.getParticleStore().getPositions();
+    };
+
+    const double tolerance = SolverTestScenes::tolerance(1e-5, 1e-12);
+    std::vector<Vec3> scattered = run(false);
+    std::vector<Vec3> fused = run(true);
+    ASSERT_EQ(scattered.size(), fused.size());
+    for (size_t i = 0; i < fused.size(); ++i)
+        EXPECT_NEAR((scattered[i] - fused[i]).norm(), 0.0, tolerance);
+}
+
+TEST(PositionPredictionTest, DampingScalesTheCarriedVelocity) {
+    auto run = [](Scalar damping) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(1);
+        solver.setDamping(damping);
+        Particle p(Vec3(0.0, 0.0, 0.0));
+        p.setOldPosition(Vec3(-0.01, 0.0, 0.0));
+        int id = solver.addParticle(p);
+
+        solver.update(world, 0.01);
+        return solver.getParticleStore().getPosition(id).x();
+    };
+
+    EXPECT_NEAR(run(1.0), 0.01, 1e-9);
+    EXPECT_NEAR(run(0.5), 0.005, 1e-9);
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "physics/MeshCollider.hpp"
+#include "physics/ParticleStore.hpp"
+#include "physics/SDFCollider.hpp"
+#include <fstream>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+std::unique_ptr<MeshCollider> makeCube() {
+    std::vector<Vec3> vertices;
+    std::vector<Triangle> triangles;
+    for (int k = 0; k < 8; ++k)
+        vertices.emplace_back(k & 1, (k >> 1) & 1, (k >> 2) & 1);
+
+    const int quads[6][4] = {
+        { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 },
+        { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 },
+    };
+    for (const auto& q : quads) {
+        triangles.emplace_back(q[0], q[1], q[2]);
+        triangles.emplace_back(q[0], q[2], q[3]);
+    }
+    return std::make_unique<MeshCollider>(vertices, triangles, 0.0);
+}
+
+}
+
+TEST(SDFColliderTest, BakedGridMatchesTheMesh) {
+    SDFCollider sdf(*makeCube(), 0.05, 3, 0.0);
+
+    Vec3 gradient;
+    EXPECT_NEAR(sdf.sample(Vec3(0.5, 1.1, 0.5), gradient), 0.1, 1e-5);
+    EXPECT_TRUE(gradient.isApprox(Vec3::UnitY(), 1e-4));
+
+    EXPECT_NEAR(sdf.sample(Vec3(0.52, 0.5, -0.07), gradient), 0.07, 1e-5);
+    EXPECT_TRUE(gradient.isApprox(-Vec3::UnitZ(), 1e-4));
+
+    // Beyond the band the sign still tells inside from outside.
+    EXPECT_NEAR(sdf.sample(Vec3(0.5, 0.5, 0.5), gradient), -sdf.getBandWidth(), 1e-6);
+    EXPECT_NEAR(sdf.sample(Vec3(0.5, 0.5, 1.4), gradient), sdf.getBandWidth(), 1e-6);
+    EXPECT_NEAR(sdf.sample(Vec3(9.0, 0.0, 0.0), gradient), sdf.getBandWidth(), 1e-6);
+}
+
+TEST(SDFColliderTest, ResolveProjectsAlongTheGradient) {
+    SDFCollider sdf(*makeCube(), 0.05, 3, 0.0);
+
+    ParticleStore store;
+    int id = store.add(Particle(Vec3(0.4, 0.97, 0.6)));
+    store.getOldPositions()[id] = Vec3(0.3, 1.2, 0.6);
+    int free = store.add(Particle(Vec3(0.4, 1.5, 0.6)));
+
+    sdf.resolve(store, 0.01, 0.05);
+
+    EXPECT_NEAR(store.getPosition(id).y(), 1.05, 1e-5);
+    EXPECT_NEAR(store.getPosition(id).x(), 0.4, 1e-5);
+    EXPECT_NEAR(store.getPosition(id).x() - store.getOldPosition(id).x(), 0.1, 1e-5);
+    EXPECT_TRUE(store.getPosition(free).isApprox(Vec3(0.4, 1.5, 0.6)));
+}
+
+TEST(SDFColliderTest, CacheRoundTrip) {
+    SDFCollider sdf(*makeCube(), 0.1, 2, 0.3);
+    const std::string path = ::testing::TempDir() + "sdf_collider_cache.bin";
+    ASSERT_TRUE(sdf.save(path));
+
+    std::unique_ptr<SDFCollider> loaded = SDFCollider::load(path, 0.3);
+    ASSERT_NE(loaded, nullptr);
+    for (int axis = 0; axis < 3; ++axis)
+        EXPECT_EQ(loaded->getResolution(axis), sdf.getResolution(axis));
+
+    Vec3 expected, actual;
+    for (const Vec3& p : { Vec3(0.3, 1.05, 0.2), Vec3(-0.1, 0.4, 0.7), Vec3(0.5, 0.5, 0.5) }) {
+        EXPECT_FLOAT_EQ(loaded->sample(p, actual), sdf.sample(p, expected));
+        EXPECT_TRUE(actual.isApprox(expected));
+    }
+
+    std::ofstream(path, std::ios::binary) << "not a grid";
+    EXPECT_EQ(SDFCollider::load(path, 0.3), nullptr);
+}
+
+TEST(SDFColliderTest, InvalidCellSizesGiveAnEmptyGrid) {
+    std::unique_ptr<MeshCollider> cube = makeCube();
+    SDFCollider zeroCell(*cube, 0.0, 3, 0.0);
+    SDFCollider negativeCell(*cube, -0.05, 3, 0.0);
+    SDFCollider tooFine(*cube, 1e-4, 3, 0.0);
+
+    Vec3 lower, upper;
+    for (SDFCollider* sdf : { &zeroCell, &negativeCell, &tooFine }) {
+        EXPECT_FALSE(sdf->getBounds(lower, upper));
+
+        ParticleStore store;
+        const int id = store.add(Particle(Vec3(0.5, 0.98, 0.5)));
+        sdf->resolve(store, 0.01, 0.05);
+        EXPECT_TRUE(store.getPosition(id).isApprox(Vec3(0.5, 0.98, 0.5)));
+    }
+}
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+#include "physics/Solver.hpp"
+#include "engine/World.hpp"
+#include "solver_test_scenes.hpp"
+#include <omp.h>
+#include <vector>
+
+using namespace ClothSDK;
+
+TEST(SelfCollisionModeTest, ModesSeparateOverlappingParticles) {
+    for (SelfCollisionMode mode : { SelfCollisionMode::Sequential, SelfCollisionMode::Parallel }) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(1);
+        solver.setSelfCollisionMode(mode);
+        int a = solver.addParticle(Particle(Vec3(0.0, 0.0, 0.0)));
+        int b = solver.addParticle(Particle(Vec3(0.01, 0.0, 0.0)));
+        solver.update(world, 0.001);
+
+        const ParticleStore& particles = solver.getParticleStore();
+        Scalar distance = (particles.getPosition(a) - particles.getPosition(b)).norm();
+        EXPECT_NEAR(distance, world.getThickness(), 1e-4);
+    }
+
+    EXPECT_EQ(Solver().getSelfCollisionMode(), SelfCollisionMode::Sequential);
+}
+
+TEST(SelfCollisionModeTest, ParallelIsIndependentOfThreadCount) {
+    auto run = [](int threads) {
+        omp_set_num_threads(threads);
+        World world;
+        Solver solver;
+        solver.setSubsteps(2);
+        solver.setSelfCollisionMode(SelfCollisionMode::Parallel);
+        SolverTestScenes::addParticleBlock(solver, 0.01);
+        solver.update(world, 0.01);
+
+        std::vector<Vec3> positions = solver.getParticleStore().getPositions();
+        return positions;
+    };
+
+    const int maxThreads = omp_get_max_threads();
+    std::vector<Vec3> single = run(1);
+    std::vector<Vec3> multi = run(4);
+    omp_set_num_threads(maxThreads);
+
+    for (size_t i = 0; i < single.size(); ++i)
+        EXPECT_EQ(single[i], multi[i]);
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "physics/Constraint.hpp"
+#include "physics/GravityForce.hpp"
+#include "physics/PlaneCollider.hpp"
+#include "physics/Solver.hpp"
+#include "physics/SphereCollider.hpp"
+#include "engine/World.hpp"
+#include <memory>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+// Flat 4 x 4 patch of particles at the given height, one island.
+void addPatch(Solver& solver, const Vec3& corner) {
+    const int first = solver.getParticleCount();
+    for (int z = 0; z < 4; ++z)
+        for (int x = 0; x < 4; ++x)
+            solver.addParticle(Particle(corner + Vec3(0.05 * x, 0.0, 0.05 * z)));
+    for (int z = 0; z < 4; ++z) {
+        for (int x = 0; x < 4; ++x) {
+            const int i = first + z * 4 + x;
+            if (x < 3) solver.addDistanceConstraint(i, i + 1, 0.0);
+            if (z < 3) solver.addDistanceConstraint(i, i + 4, 0.0);
+        }
+    }
+}
+
+// Counts its projections and reports no footprint, so it may touch any particle.
+class GlobalConstraint : public Constraint {
+public:
+    explicit GlobalConstraint(int* calls) : m_calls(calls) {}
+
+    void solve(ParticleStore& particles, Scalar dt) override { ++(*m_calls); }
+
+private:
+    int* m_calls;
+};
+
+void setUp(World& world, Solver& solver) {
+    world.setThickness(0.02);
+    world.addForce(std::make_shared<GravityForce>(world.getGravity()));
+    world.addCollider(std::make_shared<PlaneCollider>(Vec3::Zero(), Vec3::UnitY(), 0.5));
+    solver.setSubsteps(4);
+    solver.setSleeping(true);
+    solver.setSleepFrames(10);
+}
+
+}
+
+TEST(SleepingTest, RestingIslandsFallAsleep) {
+    World world;
+    Solver solver;
+    setUp(world, solver);
+    addPatch(solver, Vec3(0.0, 0.02, 0.0));
+    addPatch(solver, Vec3(1.0, 1.0, 0.0));
+    solver.addPin(0, Vec3(0.0, 0.02, 0.0));
+
+    for (int frame = 0; frame < 20; ++frame)
+        solver.update(world, 1.0 / 60.0);
+
+    // The patch on the floor sleeps while the other is still falling.
+    EXPECT_EQ(solver.getIslandCount(), 2);
+    EXPECT_TRUE(solver.isParticleSleeping(0));
+    EXPECT_FALSE(solver.isParticleSleeping(16));
+    EXPECT_EQ(solver.getFrameStats().sleepingIslands, 1);
+    EXPECT_EQ(solver.getFrameStats().activeParticles, 16);
+
+    // Constraints of the sleeping patch leave the solve but are still listed.
+    EXPECT_EQ(solver.getDistanceConstraints().size(), 48u);
+    ASSERT_EQ(solver.getPinConstraints().size(), 1u);
+    EXPECT_EQ(solver.getPinConstraints()[0].particleId, 0);
+
+    const Vec3 resting = solver.getParticleStore().getPosition(5);
+    for (int frame = 0; frame < 120; ++frame)
+        solver.update(world, 1.0 / 60.0);
+
+    EXPECT_EQ(solver.getParticleStore().getPosition(5), resting);
+    EXPECT_EQ(solver.getFrameStats().sleepingIslands, 2);
+    EXPECT_EQ(solver.getFrameStats().activeParticles, 0);
+}
+
+TEST(SleepingTest, ContactAndForceChangesWakeIslands) {
+    World world;
+    Solver solver;
+    setUp(world, solver);
+    addPatch(solver, Vec3(0.0, 0.02, 0.0));
+    for (int frame = 0; frame < 20; ++frame)
+        solver.update(world, 1.0 / 60.0);
+    ASSERT_TRUE(solver.isParticleSleeping(0));
+
+    // A sphere pushed into the patch wakes it.
+    auto sphere = std::make_shared<SphereCollider>(Vec3(0.075, 0.5, 0.075), 0.1, 0.5);
+    world.addCollider(sphere);
+    solver.update(world, 1.0 / 60.0);
+    EXPECT_TRUE(solver.isParticleSleeping(0));
+    sphere->setCenter(Vec3(0.075, 0.1, 0.075));
+    solver.update(world, 1.0 / 60.0);
+    EXPECT_FALSE(solver.isParticleSleeping(0));
+    EXPECT_EQ(solver.getDistanceConstraints().size(), 24u);
+
+    // Once asleep again, a new uniform force wakes it too.
+    sphere->setCenter(Vec3(0.075, 0.5, 0.075));
+    for (int frame = 0; frame < 240; ++frame)
+        solver.update(world, 1.0 / 60.0);
+    ASSERT_TRUE(solver.isParticleSleeping(0));
+    world.addForce(std::make_shared<GravityForce>(Vec3(1.0, 0.0, 0.0)));
+    solver.update(world, 1.0 / 60.0);
+    EXPECT_FALSE(solver.isParticleSleeping(0));
+    EXPECT_GT(solver.getParticleStore().getPosition(0).x(), 0.0);
+}
+
+TEST(SleepingTest, PlanePassSkipsSleepingParticles) {
+    World world;
+    Solver solver;
+    setUp(world, solver);
+    addPatch(solver, Vec3(0.0, 0.02, 0.0));
+    addPatch(solver, Vec3(1.0, 1.0, 0.0));
+    for (int frame = 0; frame < 20; ++frame)
+        solver.update(world, 1.0 / 60.0);
+    ASSERT_TRUE(solver.isParticleSleeping(0));
+    ASSERT_FALSE(solver.isParticleSleeping(16));
+
+    // A raised floor would lift the resting patch, but only the falling one is passed to it.
+    world.addCollider(std::make_shared<PlaneCollider>(Vec3(0.0, 0.1, 0.0), Vec3::UnitY(), 0.5));
+    const Vec3 resting = solver.getParticleStore().getPosition(5);
+    solver.update(world, 1.0 / 60.0);
+
+    EXPECT_TRUE(solver.isParticleSleeping(0));
+    EXPECT_EQ(solver.getParticleStore().getPosition(5), resting);
+    EXPECT_GT(solver.getParticleStore().getPosition(16).y(), 0.1);
+}
+
+TEST(SleepingTest, ConstraintsWithoutFootprintStayAwake) {
+    World world;
+    Solver solver;
+    setUp(world, solver);
+    addPatch(solver, Vec3(0.0, 0.02, 0.0));
+    addPatch(solver, Vec3(1.0, 1.0, 0.0));
+    int calls = 0;
+    solver.addConstraint(std::make_unique<GlobalConstraint>(&calls));
+    for (int frame = 0; frame < 20; ++frame)
+        solver.update(world, 1.0 / 60.0);
+    ASSERT_TRUE(solver.isParticleSleeping(0));
+    ASSERT_FALSE(solver.isParticleSleeping(16));
+
+    const int before = calls;
+    solver.update(world, 1.0 / 60.0);
+    EXPECT_GT(calls, before);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "engine/Cloth.hpp"
+#include "engine/ClothMesh.hpp"
+#include "engine/World.hpp"
+#include "physics/Solver.hpp"
+#include <memory>
+#include <type_traits>
+
+// Small scenes shared by the solver-level tests.
+namespace SolverTestScenes {
+
+// Comparison tolerance for the active Scalar precision.
+inline double tolerance(double forFloat, double forDouble) {
+    return std::is_same<ClothSDK::Scalar, float>::value ? forFloat : forDouble;
+}
+
+// Grid cloth of rows x cols particles, registered with the world.
+inline std::shared_ptr<ClothSDK::Cloth> addGridCloth(ClothSDK::World& world, ClothSDK::Solver& solver,
+                                                     int rows, int cols, double spacing) {
+    auto cloth = std::make_shared<ClothSDK::Cloth>("cloth", std::make_shared<ClothSDK::ClothMaterial>());
+    ClothSDK::ClothMesh mesh;
+    mesh.initGrid(rows, cols, spacing, *cloth, solver);
+    world.addCloth(cloth);
+    return cloth;
+}
+
+// One large static triangle spanning (0,0,0), (1,0,0) and (0,0,1).
+inline void addStaticTriangle(ClothSDK::World& world, ClothSDK::Solver& solver) {
+    auto cloth = std::make_shared<ClothSDK::Cloth>("sheet", std::make_shared<ClothSDK::ClothMaterial>());
+    int a = solver.addParticle(ClothSDK::Particle(ClothSDK::Vec3(0.0, 0.0, 0.0)));
+    int b = solver.addParticle(ClothSDK::Particle(ClothSDK::Vec3(1.0, 0.0, 0.0)));
+    int c = solver.addParticle(ClothSDK::Particle(ClothSDK::Vec3(0.0, 0.0, 1.0)));
+    for (int id : { a, b, c }) {
+        solver.setParticleInverseMass(id, 0.0);
+        cloth->addParticleId(id);
+    }
+    cloth->addTriangle(ClothSDK::Triangle(a, b, c));
+    world.addCloth(cloth);
+}
+
+// 4 x 4 x 4 block of free particles, closer together than the collision thickness.
+inline void addParticleBlock(ClothSDK::Solver& solver, ClothSDK::Scalar spacing) {
+    for (int i = 0; i < 64; ++i)
+        solver.addParticle(ClothSDK::Particle(ClothSDK::Vec3((i % 4) * spacing, ((i / 4) % 4) * spacing, (i / 16) * spacing)));
+}
+
+// Pins a particle where it currently is.
+inline void pinInPlace(ClothSDK::Solver& solver, int id) {
+    solver.addPin(id, solver.getParticleStore().getPosition(id));
+}
+
+}
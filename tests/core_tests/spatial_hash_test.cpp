@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "physics/SpatialHash.hpp"
-#include "physics/Particle.hpp"
+#include "physics/ParticleStore.hpp"
+#include <algorithm>
 #include <vector>
 
 using namespace ClothSDK;
@@ -8,41 +9,41 @@ using namespace ClothSDK;
 class SpatialHashTest : public ::testing::Test {
 protected:
     SpatialHash hash = SpatialHash(1000, 1.0);
-    std::vector<Particle> particles;
+    ParticleStore particles;
 };
 
 TEST_F(SpatialHashTest, FindsNeighborInSameCell) {
-    particles.push_back(Particle(Eigen::Vector3d(0.0, 0.0, 0.0)));
-    particles.push_back(Particle(Eigen::Vector3d(0.1, 0.0, 0.0)));
+    particles.add(Particle(Vec3(0.0, 0.0, 0.0)));
+    particles.add(Particle(Vec3(0.1, 0.0, 0.0)));
 
     hash.build(particles);
 
     std::vector<int> neighbors;
-    hash.query(particles, particles[0].getPosition(), 0.2, neighbors);
+    hash.query(particles, particles.getPosition(0), 0.2, neighbors);
 
     EXPECT_EQ(neighbors.size(), 2);
 }
 
 TEST_F(SpatialHashTest, FindsNeighborInAdjacentCell) {
-    particles.push_back(Particle(Eigen::Vector3d(0.9, 0.0, 0.0))); 
-    particles.push_back(Particle(Eigen::Vector3d(1.1, 0.0, 0.0))); 
+    particles.add(Particle(Vec3(0.9, 0.0, 0.0))); 
+    particles.add(Particle(Vec3(1.1, 0.0, 0.0))); 
 
     hash.build(particles);
 
     std::vector<int> neighbors;
-    hash.query(particles, particles[0].getPosition(), 0.5, neighbors);
+    hash.query(particles, particles.getPosition(0), 0.5, neighbors);
 
     EXPECT_EQ(neighbors.size(), 2);
 }
 
 TEST_F(SpatialHashTest, FiltersOutParticlesBeyondRadius) {
-    particles.push_back(Particle(Eigen::Vector3d(0.0, 0.0, 0.0)));
-    particles.push_back(Particle(Eigen::Vector3d(0.9, 0.0, 0.0)));
+    particles.add(Particle(Vec3(0.0, 0.0, 0.0)));
+    particles.add(Particle(Vec3(0.9, 0.0, 0.0)));
 
     hash.build(particles);
 
     std::vector<int> neighbors;
-    hash.query(particles, particles[0].getPosition(), 0.5, neighbors);
+    hash.query(particles, particles.getPosition(0), 0.5, neighbors);
 
     EXPECT_EQ(neighbors.size(), 1);
     EXPECT_EQ(neighbors[0], 0);
@@ -50,13 +51,69 @@ TEST_F(SpatialHashTest, FiltersOutParticlesBeyondRadius) {
 
 TEST_F(SpatialHashTest, HandlesMultipleParticles) {
     for(int i = 0; i < 10; ++i) {
-        particles.push_back(Particle(Eigen::Vector3d(i * 0.1, 0.0, 0.0)));
+        particles.add(Particle(Vec3(i * 0.1, 0.0, 0.0)));
     }
 
     hash.build(particles);
 
     std::vector<int> neighbors;
-    hash.query(particles, particles[5].getPosition(), 0.15, neighbors);
+    hash.query(particles, particles.getPosition(5), 0.15, neighbors);
 
     EXPECT_EQ(neighbors.size(), 3);
-}
\ No newline at end of file
+}
+
+TEST_F(SpatialHashTest, ParallelBuildMatchesBruteForce) {
+    const int count = 3 * SpatialHash::ParallelThreshold;
+    unsigned int seed = 12345;
+    auto random = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<double>(seed >> 8) / static_cast<double>(1u << 24);
+    };
+    for (int i = 0; i < count; ++i)
+        particles.add(Particle(Vec3(random() * 20.0, random() * 20.0, random() * 20.0)));
+
+    SpatialHash parallelHash(1009, 1.0);
+    parallelHash.build(particles);
+
+    const Scalar radius = 1.0;
+    std::vector<int> neighbors;
+    for (int i = 0; i < count; i += 97) {
+        parallelHash.query(particles, particles.getPosition(i), radius, neighbors);
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+        std::vector<int> expected;
+        for (int j = 0; j < count; ++j) {
+            if ((particles.getPosition(j) - particles.getPosition(i)).squaredNorm() < radius * radius)
+                expected.push_back(j);
+        }
+        EXPECT_EQ(neighbors, expected);
+    }
+}
+
+TEST_F(SpatialHashTest, BoxQueryIsSortedUniqueAndExact) {
+    SpatialHash hash(10007, 0.25);
+    for (int i = 0; i < 200; ++i)
+        particles.add(Particle(Vec3((i % 10) * 0.1, ((i / 10) % 5) * 0.1, (i / 50) * 0.1)));
+    hash.build(particles);
+
+    // Drift a particle from just outside the first box into it by less than a cell, without rebinning.
+    particles.setPosition(126, Vec3(0.5, 0.2, 0.2));
+
+    // Each box spans at most 4 x 4 x 4 padded cells, fewer than the particles and the
+    // table, so the cell walk is used rather than the linear scan.
+    for (const Vec3& lower : { Vec3(0.25, 0.05, 0.05), Vec3(0.0, 0.0, 0.0), Vec3(0.42, 0.13, 0.11) }) {
+        const Vec3 upper = lower + Vec3(0.3, 0.2, 0.2);
+        std::vector<int> found;
+        hash.queryBox(particles, lower, upper, found);
+
+        std::vector<int> expected;
+        for (int i = 0; i < particles.size(); ++i) {
+            const Vec3& p = particles.getPosition(i);
+            if ((p.array() >= lower.array()).all() && (p.array() <= upper.array()).all())
+                expected.push_back(i);
+        }
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(found, expected);
+    }
+}
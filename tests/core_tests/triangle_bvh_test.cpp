@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "physics/Proximity.hpp"
+#include "physics/TriangleBVH.hpp"
+#include "solver_test_scenes.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+void buildGrid(int rows, int cols, std::vector<Vec3>& positions, std::vector<Triangle>& triangles) {
+    for (int r = 0; r < rows; ++r)
+        for (int c = 0; c < cols; ++c)
+            positions.emplace_back(c * 0.1, r * 0.1, 0.0);
+
+    for (int r = 0; r + 1 < rows; ++r) {
+        for (int c = 0; c + 1 < cols; ++c) {
+            int a = r * cols + c;
+            triangles.emplace_back(a, a + 1, a + cols + 1);
+            triangles.emplace_back(a, a + cols + 1, a + cols);
+        }
+    }
+}
+
+std::vector<int> bruteForce(const std::vector<Vec3>& positions, const std::vector<Triangle>& triangles, const Vec3& lower, const Vec3& upper) {
+    std::vector<int> result;
+    for (int t = 0; t < static_cast<int>(triangles.size()); ++t) {
+        const Triangle& tri = triangles[t];
+        Vec3 tLower = positions[tri.a].cwiseMin(positions[tri.b]).cwiseMin(positions[tri.c]);
+        Vec3 tUpper = positions[tri.a].cwiseMax(positions[tri.b]).cwiseMax(positions[tri.c]);
+        if ((tLower.array() <= upper.array()).all() && (tUpper.array() >= lower.array()).all())
+            result.push_back(t);
+    }
+    return result;
+}
+
+}
+
+TEST(TriangleBVHTest, RefittedQueriesMatchBruteForce) {
+    std::vector<Vec3> positions;
+    std::vector<Triangle> triangles;
+    buildGrid(16, 12, positions, triangles);
+
+    TriangleBVH bvh;
+    bvh.build(triangles, positions);
+    ASSERT_FALSE(bvh.empty());
+
+    // Fold the sheet so boxes change shape and move relative to each other.
+    for (Vec3& p : positions)
+        p = Vec3(p.x(), 0.4 * std::sin(3.0 * p.y()), 0.4 * std::cos(3.0 * p.y()) + 0.05 * p.x());
+    bvh.refit(positions);
+
+    std::vector<int> found;
+    for (const Vec3& center : { Vec3(0.3, 0.0, 0.4), Vec3(0.55, 0.3, -0.2), Vec3(5.0, 5.0, 5.0) }) {
+        const Vec3 pad = Vec3::Constant(0.08);
+        bvh.query(center - pad, center + pad, found);
+        std::sort(found.begin(), found.end());
+        std::vector<int> expected = bruteForce(positions, triangles, center - pad, center + pad);
+        EXPECT_TRUE(std::includes(found.begin(), found.end(), expected.begin(), expected.end()));
+        EXPECT_LE(found.size(), expected.size() + 8 * TriangleBVH::LeafSize);
+    }
+}
+
+TEST(TriangleBVHTest, ProximityPrimitives) {
+    const Vec3 a(0.0, 0.0, 0.0), b(1.0, 0.0, 0.0), c(0.0, 1.0, 0.0);
+    Vec3 bary;
+
+    Vec3 q = Proximity::closestPointOnTriangle(Vec3(0.25, 0.25, 0.5), a, b, c, bary);
+    EXPECT_NEAR((q - Vec3(0.25, 0.25, 0.0)).norm(), 0.0, 1e-6);
+    EXPECT_NEAR(bary.sum(), 1.0, 1e-6);
+
+    q = Proximity::closestPointOnTriangle(Vec3(2.0, -1.0, 0.0), a, b, c, bary);
+    EXPECT_NEAR((q - b).norm(), 0.0, 1e-6);
+
+    Scalar s, t;
+    Scalar distSq = Proximity::closestPointsOnSegments(Vec3(-1.0, 0.0, 0.0), Vec3(1.0, 0.0, 0.0),
+                                                       Vec3(0.5, -1.0, 0.2), Vec3(0.5, 1.0, 0.2), s, t);
+    EXPECT_NEAR(distSq, 0.04, 1e-6);
+    EXPECT_NEAR(s, 0.75, 1e-6);
+    EXPECT_NEAR(t, 0.5, 1e-6);
+}
+
+TEST(TriangleBVHTest, SolverBackendCatchesPointsBetweenVertices) {
+    auto run = [](SelfCollisionBackend backend, SelfCollisionMode mode) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(4);
+        solver.setSelfCollisionBackend(backend);
+        solver.setSelfCollisionMode(mode);
+
+        // The free particle sits over the triangle interior, far from every vertex.
+        SolverTestScenes::addStaticTriangle(world, solver);
+        int p = solver.addParticle(Particle(Vec3(0.25, 0.01, 0.25)));
+        solver.update(world, 0.01);
+        return solver.getParticleStore().getPosition(p).y();
+    };
+
+    for (SelfCollisionMode mode : { SelfCollisionMode::Sequential, SelfCollisionMode::Parallel }) {
+        EXPECT_LT(run(SelfCollisionBackend::SpatialHash, mode), 0.011);
+        EXPECT_GT(run(SelfCollisionBackend::TriangleBVH, mode), 0.019);
+    }
+}
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include "physics/Solver.hpp"
+#include "engine/World.hpp"
+#include "solver_test_scenes.hpp"
+#include <vector>
+
+using namespace ClothSDK;
+
+TEST(VerletListTest, MatchesSpatialHashBackend) {
+    auto run = [](SelfCollisionBackend backend, int* builds) {
+        World world;
+        Solver solver;
+        solver.setSubsteps(3);
+        solver.setSelfCollisionMode(SelfCollisionMode::Parallel);
+        solver.setSelfCollisionBackend(backend);
+        solver.setVerletSkin(0.01);
+        SolverTestScenes::addParticleBlock(solver, 0.015);
+        solver.update(world, 0.01);
+        solver.update(world, 0.01);
+        if (builds) *builds = solver.getVerletBuildCount();
+        return solver.getParticleStore().getPositions();
+    };
+
+    int builds = 0;
+    std::vector<Vec3> hashed = run(SelfCollisionBackend::SpatialHash, nullptr);
+    std::vector<Vec3> cached = run(SelfCollisionBackend::VerletList, &builds);
+
+    const double tolerance = SolverTestScenes::tolerance(1e-6, 1e-9);
+    for (size_t i = 0; i < hashed.size(); ++i)
+        EXPECT_NEAR((hashed[i] - cached[i]).norm(), 0.0, tolerance);
+    EXPECT_GE(builds, 1);
+    EXPECT_LT(builds, 6);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "physics/AerodynamicForce.hpp"
+#include "physics/ParticleStore.hpp"
+#include "physics/WindField.hpp"
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace ClothSDK;
+
+namespace {
+
+// 2 x 2 x 2 tile whose x component is the sample's x index.
+WindField makeRamp() {
+    std::vector<Vec3> velocities;
+    for (int k = 0; k < 8; ++k)
+        velocities.emplace_back(k & 1, 0.0, 1.0);
+    return WindField(Vec3::Zero(), 0.5, 2, 2, 2, velocities);
+}
+
+}
+
+TEST(WindFieldTest, SamplesTrilinearlyAndRepeats) {
+    WindField field = makeRamp();
+
+    EXPECT_TRUE(field.sample(Vec3(0.0, 0.0, 0.0), 0.0).isApprox(Vec3(0.0, 0.0, 1.0)));
+    EXPECT_TRUE(field.sample(Vec3(0.5, 0.2, 0.3), 0.0).isApprox(Vec3(1.0, 0.0, 1.0)));
+    EXPECT_TRUE(field.sample(Vec3(0.25, 0.0, 0.0), 0.0).isApprox(Vec3(0.5, 0.0, 1.0)));
+
+    // Between the last sample and the wrapped first one, and one period further on.
+    EXPECT_TRUE(field.sample(Vec3(0.75, 0.0, 0.0), 0.0).isApprox(Vec3(0.5, 0.0, 1.0)));
+    EXPECT_TRUE(field.sample(Vec3(-0.5, 3.0, -7.0), 0.0).isApprox(Vec3(1.0, 0.0, 1.0)));
+
+    // The pattern moves downwind with the drift.
+    field.setDrift(Vec3(0.25, 0.0, 0.0));
+    EXPECT_TRUE(field.sample(Vec3(0.75, 0.0, 0.0), 1.0).isApprox(Vec3(1.0, 0.0, 1.0)));
+}
+
+TEST(WindFieldTest, InvalidSamplesGiveACalmField) {
+    const std::vector<Vec3> velocities(8, Vec3(1.0, 2.0, 3.0));
+    const WindField tooFew(Vec3::Zero(), 0.5, 3, 2, 2, velocities);
+    const WindField zeroAxis(Vec3::Zero(), 0.5, 0, 2, 2, velocities);
+    const WindField zeroCell(Vec3::Zero(), 0.0, 2, 2, 2, velocities);
+    const WindField nanCell(Vec3::Zero(), std::numeric_limits<Scalar>::quiet_NaN(), 2, 2, 2, velocities);
+
+    for (const WindField* field : { &tooFew, &zeroAxis, &zeroCell, &nanCell })
+        EXPECT_TRUE(field->sample(Vec3(0.3, -1.2, 4.0), 0.5).isZero());
+
+    // Files are held to the same rules: overwrite the cell size of a saved grid.
+    const std::string path = ::testing::TempDir() + "wind_field_cell.bin";
+    ASSERT_TRUE(makeRamp().save(path));
+    for (double cellSize : { 0.0, -0.5, std::numeric_limits<double>::quiet_NaN() }) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(4 + 4 + 3 * sizeof(std::int32_t) + 3 * sizeof(double));
+        file.write(reinterpret_cast<const char*>(&cellSize), sizeof(cellSize));
+        file.close();
+        EXPECT_EQ(WindField::load(path), nullptr);
+    }
+}
+
+TEST(WindFieldTest, TurbulenceHasTheRequestedStrength) {
+    std::unique_ptr<WindField> field = WindField::turbulence(16, 0.25, 2.0, 7);
+    std::unique_ptr<WindField> same = WindField::turbulence(16, 0.25, 2.0, 7);
+
+    Vec3 mean = Vec3::Zero();
+    double sumSq = 0.0;
+    for (int z = 0; z < 16; ++z) {
+        for (int y = 0; y < 16; ++y) {
+            for (int x = 0; x < 16; ++x) {
+                const Vec3 p = Vec3(x, y, z) * 0.25;
+                const Vec3 v = field->sample(p, 0.0);
+                EXPECT_EQ(v, same->sample(p, 0.0));
+                mean += v;
+                sumSq += v.squaredNorm();
+            }
+        }
+    }
+
+    EXPECT_NEAR(std::sqrt(sumSq / 4096.0), 2.0, 1e-3);
+    EXPECT_NEAR((mean / 4096.0).norm(), 0.0, 1e-3);
+}
+
+TEST(WindFieldTest, FileRoundTrip) {
+    std::unique_ptr<WindField> field = WindField::turbulence(8, 0.1, 1.0, 3);
+    field->setDrift(Vec3(1.0, 0.0, 0.5));
+    const std::string path = ::testing::TempDir() + "wind_field.bin";
+    ASSERT_TRUE(field->save(path));
+
+    std::unique_ptr<WindField> loaded = WindField::load(path);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_TRUE(loaded->getDrift().isApprox(field->getDrift()));
+    for (const Vec3& p : { Vec3(0.13, 0.52, 0.07), Vec3(-0.4, 0.9, 2.3) })
+        EXPECT_TRUE(loaded->sample(p, 0.3).isApprox(field->sample(p, 0.3)));
+
+    std::ofstream(path, std::ios::binary) << "not a grid";
+    EXPECT_EQ(WindField::load(path), nullptr);
+}
+
+TEST(WindFieldTest, AerodynamicForceSamplesTheFieldPerFace) {
+    // Two separate faces in opposite halves of a field blowing along +z and -z.
+    std::vector<Vec3> velocities;
+    for (int k = 0; k < 8; ++k)
+        velocities.emplace_back(0.0, 0.0, (k & 1) ? -3.0 : 3.0);
+    auto field = std::make_shared<WindField>(Vec3::Zero(), 1.0, 2, 2, 2, velocities);
+
+    ParticleStore store;
+    for (Scalar x : { 0.0, 1.0 }) {
+        store.add(Particle(Vec3(x, 0.0, 0.0)));
+        store.add(Particle(Vec3(x, 0.01, 0.0)));
+        store.add(Particle(Vec3(x + 0.01, 0.0, 0.0)));
+    }
+    AerodynamicForce aero({ { 0, 1, 2 }, { 3, 4, 5 } }, Vec3::Zero(), 1.2);
+    aero.setWindField(field);
+    aero.apply(store, 0.01);
+
+    EXPECT_GT(store.getAcceleration(0).z(), 0.0);
+    EXPECT_LT(store.getAcceleration(3).z(), 0.0);
+}
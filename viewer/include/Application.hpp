@@ -84,7 +84,7 @@ private:
     double m_initSpacing;
     char m_configPathBuffer[256] = "data/configs/silk.json";
 
-    std::vector<Eigen::Vector3d> m_originalPositions;
+    std::vector<Vec3> m_originalPositions;
     std::vector<int> m_originalIndices;
 };
 
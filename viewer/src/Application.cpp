@@ -277,7 +277,7 @@ void Application::drawUI() {
 
     if (ImGui::CollapsingHeader("Statistics", ImGuiTreeNodeFlags_DefaultOpen)) {
         ImGui::Text("Application FPS: %.1f", ImGui::GetIO().Framerate);
-        ImGui::Text("Particles: %d", (int)m_solver->getParticles().size());
+        ImGui::Text("Particles: %d", m_solver->getParticleCount());
     }
 
     ImGui::SeparatorText("Playback");
@@ -290,7 +290,7 @@ void Application::drawUI() {
     if (ImGui::CollapsingHeader("Global Physics")) {
         static float gY = -9.81f;
         if (ImGui::SliderFloat("Gravity Y", &gY, -20.0f, 2.0f)) {
-            m_world->setGravity(Eigen::Vector3d(0, gY, 0));
+            m_world->setGravity(Vec3(0, gY, 0));
         }
 
         static int subs = m_solver->getSubsteps();
@@ -310,7 +310,7 @@ void Application::drawUI() {
 
             ImGui::InputFloat3("Direction", windDir);
 
-            Eigen::Vector3d dir(windDir[0], windDir[1], windDir[2]);
+            Vec3 dir(windDir[0], windDir[1], windDir[2]);
 
             if (dir.norm() > 1e-6) {
                 dir.normalize();
@@ -319,7 +319,7 @@ void Application::drawUI() {
             if (windEnabled) {
                 m_world->setWind(dir * windStrength);
             } else {
-                m_world->setWind(Eigen::Vector3d::Zero());
+                m_world->setWind(Vec3::Zero());
             }
         }
     }
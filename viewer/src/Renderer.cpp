@@ -46,13 +46,12 @@ bool Renderer::init() {
 }
 
 void Renderer::render(const ClothSDK::Solver& solver, const Camera& camera) {
-    const auto& particles = solver.getParticles();
+    const auto& particles = solver.getParticleStore().getPositions();
     if (particles.empty()) return;
 
     m_vertexBuffer.clear();
     m_vertexBuffer.reserve(particles.size() * 3);
-    for (const auto& p : particles) {
-        Eigen::Vector3d pos = p.getPosition();
+    for (const auto& pos : particles) {
         m_vertexBuffer.push_back(static_cast<float>(pos.x()));
         m_vertexBuffer.push_back(static_cast<float>(pos.y()));
         m_vertexBuffer.push_back(static_cast<float>(pos.z()));